@@ -19,15 +19,30 @@ include $(BUILD_SHARED_LIBRARY)
 include $(CLEAR_VARS)
 LOCAL_MODULE := libfreedv
 LOCAL_LDLIBS := -llog
-LOCAL_ARM_NEON := true
+# Only the kernels_neon.c.neon kernels use NEON, they are selected at
+# run time so the library also runs on cores without it (kernels.h)
+LOCAL_ARM_NEON := false
 LOCAL_CFLAGS := -O3 -ffast-math -DNDEBUG
+# Add -DPROFILE for per-stage timing of the modem and decoder (profile.h)
 LOCAL_EXPORT_C_INCLUDES := $(LOCAL_PATH)/freedv
 LOCAL_SRC_FILES := freedv/codebook.c freedv/codebookd.c freedv/codebookdt.c \
     freedv/codebookge.c freedv/codebookjnd.c freedv/codebookjvm.c \
     freedv/codebookvqanssi.c freedv/codebookvq.c freedv/codec2.c \
-    freedv/comp.c freedv/fdmdv.c freedv/interp.c freedv/kiss_fft.c \
+    freedv/comp.c freedv/fdmdv.c freedv/interp.c freedv/kernels.c \
+    freedv/kernels_check.c freedv/kiss_fft.c freedv/kiss_fftr.c \
     freedv/lpc.c freedv/lsp.c freedv/nlp.c freedv/pack.c freedv/phase.c \
-    freedv/postfilter.c freedv/quantise.c freedv/sine.c freedv/varicode.c
+    freedv/postfilter.c freedv/prng.c freedv/profile.c freedv/quantise.c \
+    freedv/sine.c freedv/varicode.c freedv/vmath.c freedv/yin.c
+ifeq ($(TARGET_ARCH_ABI),armeabi-v7a)
+LOCAL_SRC_FILES += freedv/kernels_neon.c.neon
+endif
+ifeq ($(TARGET_ARCH_ABI),arm64-v8a)
+LOCAL_SRC_FILES += freedv/kernels_neon.c
+endif
+ifneq ($(filter x86 x86_64,$(TARGET_ARCH_ABI)),)
+LOCAL_SRC_FILES += freedv/kernels_sse2.c freedv/kernels_avx2.c
+endif
+LOCAL_STATIC_LIBRARIES := cpufeatures
 include $(BUILD_SHARED_LIBRARY)
 
 include $(CLEAR_VARS)
@@ -36,5 +51,8 @@ LOCAL_MODULE := libdroidfreedv
 LOCAL_ARM_NEON := true
 LOCAL_SHARED_LIBRARIES := libusb-1.0 freedv samplerate
 LOCAL_LDLIBS := -llog
-LOCAL_SRC_FILES := freedv_jni.c freedv_usb.c freedv_rx.c
+LOCAL_SRC_FILES := freedv_jni.c freedv_usb.c freedv_rx.c freedv_jbuf.c freedv_rtmon.c \
+    freedv_waterfall.c freedv_acq.c
 include $(BUILD_SHARED_LIBRARY)
+
+$(call import-module,android/cpufeatures)
@@ -0,0 +1,70 @@
+/*
+ * Host benchmark helpers.
+ *
+ * Every benchmark prints one JSON object per line on stdout, e.g.
+ *
+ *   {"bench":"fdmdv_demod","iters":5000,"ns_per_call":41234.5,"rtf":0.00206}
+ *
+ * On x86 bench_run() also reports cycles_per_call from the time stamp
+ * counter, which ticks at the nominal clock rate.
+ *
+ * rtf is the real time factor: processing time divided by the duration
+ * of audio handled, so anything under 1.0 keeps up with real time. It
+ * is left out for kernels that are not tied to a frame of audio.
+ *
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#define BENCH_FS 8000
+
+typedef void (*bench_fn)(void *ctx);
+
+/* Monotonic clock in seconds. */
+double bench_now(void);
+
+/* Cycle counter where the CPU has one we can read, otherwise 0. */
+unsigned long long bench_cycles(void);
+
+/* Minimum time to spend on each benchmark, BENCH_SECS env, default 0.5s. */
+double bench_min_secs(void);
+
+/*
+ * Call fn(ctx) repeatedly for at least bench_min_secs() and report the
+ * mean time per call. audio_secs is the duration of audio processed by
+ * one call, 0 if not applicable.
+ */
+void bench_run(const char *name, bench_fn fn, void *ctx, double audio_secs);
+
+/* Print a result measured elsewhere in the same format as bench_run(). */
+void bench_report(const char *name, long iters, double secs, double audio_secs);
+
+/* True if name should run given the command line filters. */
+int bench_selected(const char *name, int argc, char *argv[]);
+
+/*
+ * Deterministic speech-like test signal at BENCH_FS: a glottal pulse
+ * train with gliding pitch, two moving formants, syllable envelope and
+ * a little noise. Good enough to exercise the pitch estimator and
+ * quantisers without shipping a speech corpus.
+ */
+void bench_speech(short speech[], int n);
+
+/*
+ * Pitch of bench_speech() in Hz at sample i, and in *env (if not NULL)
+ * the syllable envelope 0..1, which is 0 in the pauses.
+ */
+float bench_speech_f0(int i, float *env);
+
+/*
+ * Fill speech[] from the raw 16 bit 8 kHz file named by the BENCH_SPEECH
+ * environment variable, repeating it if short. Returns 0 if BENCH_SPEECH
+ * is not set, leaving speech[] alone.
+ */
+int bench_load_speech(short speech[], int n);
+
+/* Gaussian noise, zero mean, unit variance, deterministic sequence. */
+float bench_randn(void);
+
+#endif /* BENCH_H */
@@ -0,0 +1,805 @@
+/*
+ * Microbenchmarks for the libfreedv kernels.
+ *
+ * usage: bench_dsp [name-filter ...]
+ *
+ * With no arguments every benchmark runs, otherwise only those whose
+ * name contains one of the arguments. Output is one JSON object per
+ * line, see bench.h.
+ *
+ * The input is the synthetic bench_speech() signal, or a raw 16 bit
+ * 8 kHz speech file if BENCH_SPEECH is set. The pitch benchmarks also
+ * report the pitch error of each engine, against the known pitch of
+ * the synthetic signal or against nlp() for a file.
+ *
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "codec2_fdmdv.h"
+#include "codec2.h"
+#include "defines.h"
+#include "kernels.h"
+#include "kiss_fft.h"
+#include "lpc.h"
+#include "lsp.h"
+#include "pitch.h"
+#include "prng.h"
+#include "quantise.h"
+#include "sine.h"
+#include "varicode.h"
+
+#include "bench.h"
+
+#define SPEECH_SECS   10
+#define SPEECH_LEN    (SPEECH_SECS*BENCH_FS)
+#define MODEM_FRAMES  250
+
+static short speech[SPEECH_LEN];
+
+/* fdmdv ---------------------------------------------------------------*/
+
+struct fdmdv_ctx {
+    struct FDMDV *fdmdv;
+    int           tx_bits[FDMDV_BITS_PER_FRAME];
+    COMP          tx_fdm[FDMDV_NOM_SAMPLES_PER_FRAME];
+    COMP         *modem;    /* MODEM_FRAMES of modulated signal */
+    int           pos;
+    int           nin;
+};
+
+static void fdmdv_mod_fn(void *p) {
+    struct fdmdv_ctx *c = p;
+    int sync_bit;
+
+    fdmdv_get_test_bits(c->fdmdv, c->tx_bits);
+    fdmdv_mod(c->fdmdv, c->tx_fdm, c->tx_bits, &sync_bit);
+}
+
+static void fdmdv_demod_fn(void *p) {
+    struct fdmdv_ctx *c = p;
+    int rx_bits[FDMDV_BITS_PER_FRAME];
+    int sync_bit;
+
+    if (c->pos + c->nin > MODEM_FRAMES*FDMDV_NOM_SAMPLES_PER_FRAME)
+        c->pos = 0;
+    fdmdv_demod(c->fdmdv, rx_bits, &sync_bit, &c->modem[c->pos], &c->nin);
+    c->pos += c->nin;
+}
+
+static void fdmdv_spectrum_fn(void *p) {
+    struct fdmdv_ctx *c = p;
+    float mag_dB[FDMDV_NSPEC];
+
+    if (c->pos + FDMDV_NOM_SAMPLES_PER_FRAME > MODEM_FRAMES*FDMDV_NOM_SAMPLES_PER_FRAME)
+        c->pos = 0;
+    fdmdv_get_rx_spectrum(c->fdmdv, mag_dB, &c->modem[c->pos], FDMDV_NOM_SAMPLES_PER_FRAME);
+    c->pos += FDMDV_NOM_SAMPLES_PER_FRAME;
+}
+
+static void bench_fdmdv(int argc, char *argv[]) {
+    struct fdmdv_ctx c;
+    int i, sync_bit;
+
+    memset(&c, 0, sizeof(c));
+    c.modem = malloc(sizeof(COMP)*MODEM_FRAMES*FDMDV_NOM_SAMPLES_PER_FRAME);
+    assert(c.modem != NULL);
+
+    c.fdmdv = fdmdv_create();
+    for (i = 0; i < MODEM_FRAMES; i++) {
+        fdmdv_get_test_bits(c.fdmdv, c.tx_bits);
+        fdmdv_mod(c.fdmdv, &c.modem[i*FDMDV_NOM_SAMPLES_PER_FRAME], c.tx_bits, &sync_bit);
+    }
+    if (bench_selected("fdmdv_mod", argc, argv))
+        bench_run("fdmdv_mod", fdmdv_mod_fn, &c, 0.02);
+    fdmdv_destroy(c.fdmdv);
+
+    c.fdmdv = fdmdv_create();
+    c.nin = FDMDV_NOM_SAMPLES_PER_FRAME;
+    c.pos = 0;
+    if (bench_selected("fdmdv_demod", argc, argv))
+        bench_run("fdmdv_demod", fdmdv_demod_fn, &c, 0.02);
+    c.pos = 0;
+    if (bench_selected("fdmdv_get_rx_spectrum", argc, argv))
+        bench_run("fdmdv_get_rx_spectrum", fdmdv_spectrum_fn, &c, 0.02);
+    fdmdv_destroy(c.fdmdv);
+
+    free(c.modem);
+}
+
+/* codec2 --------------------------------------------------------------*/
+
+struct codec2_ctx {
+    struct CODEC2 *c2;
+    int            spf;
+    int            bytes;
+    int            nframes;
+    int            frame;
+    unsigned char *bits;
+    short          out[320];
+};
+
+static void codec2_encode_fn(void *p) {
+    struct codec2_ctx *c = p;
+
+    codec2_encode(c->c2, &c->bits[c->frame*c->bytes], &speech[c->frame*c->spf]);
+    c->frame = (c->frame + 1) % c->nframes;
+}
+
+static void codec2_decode_fn(void *p) {
+    struct codec2_ctx *c = p;
+
+    codec2_decode(c->c2, c->out, &c->bits[c->frame*c->bytes]);
+    c->frame = (c->frame + 1) % c->nframes;
+}
+
+static void bench_codec2(int argc, char *argv[]) {
+    static const struct {
+        int         mode;
+        const char *encode;
+        const char *decode;
+    } modes[] = {
+        { CODEC2_MODE_3200, "codec2_encode_3200", "codec2_decode_3200" },
+        { CODEC2_MODE_2400, "codec2_encode_2400", "codec2_decode_2400" },
+        { CODEC2_MODE_1400, "codec2_encode_1400", "codec2_decode_1400" },
+        { CODEC2_MODE_1200, "codec2_encode_1200", "codec2_decode_1200" },
+    };
+    struct codec2_ctx c;
+    unsigned int m;
+    int i;
+
+    for (m = 0; m < sizeof(modes)/sizeof(modes[0]); m++) {
+        memset(&c, 0, sizeof(c));
+        c.c2 = codec2_create(modes[m].mode);
+        c.spf = codec2_samples_per_frame(c.c2);
+        c.bytes = (codec2_bits_per_frame(c.c2) + 7)/8;
+        c.nframes = SPEECH_LEN/c.spf;
+        c.bits = calloc(c.nframes, c.bytes);
+        assert(c.spf <= (int)(sizeof(c.out)/sizeof(short)));
+
+        /* encode everything once so the decoder has real bits */
+        for (i = 0; i < c.nframes; i++)
+            codec2_encode(c.c2, &c.bits[i*c.bytes], &speech[i*c.spf]);
+
+        if (bench_selected(modes[m].encode, argc, argv)) {
+            c.frame = 0;
+            bench_run(modes[m].encode, codec2_encode_fn, &c, (double)c.spf/BENCH_FS);
+        }
+        if (bench_selected(modes[m].decode, argc, argv)) {
+            c.frame = 0;
+            bench_run(modes[m].decode, codec2_decode_fn, &c, (double)c.spf/BENCH_FS);
+        }
+
+        free(c.bits);
+        codec2_destroy(c.c2);
+    }
+}
+
+/* synthesis engines ---------------------------------------------------*/
+
+/*
+ * codec2_decode() per 1400 bit/s frame with each CODEC2_SYNTH_XXX
+ * engine, then the difference of the decoded speech from the
+ * CODEC2_SYNTH_FFT reference over all of speech[].
+ */
+static void bench_synth(int argc, char *argv[]) {
+    static const char *names[] = { "synth_fft", "synth_fftr", "synth_osc" };
+    static short ref[SPEECH_LEN], out[SPEECH_LEN];
+    struct codec2_ctx c;
+    double sig, noise, d;
+    int engine, i, max_err;
+
+    memset(&c, 0, sizeof(c));
+    c.c2 = codec2_create(CODEC2_MODE_1400);
+    c.spf = codec2_samples_per_frame(c.c2);
+    c.bytes = (codec2_bits_per_frame(c.c2) + 7)/8;
+    c.nframes = SPEECH_LEN/c.spf;
+    c.bits = calloc(c.nframes, c.bytes);
+    for (i = 0; i < c.nframes; i++)
+        codec2_encode(c.c2, &c.bits[i*c.bytes], &speech[i*c.spf]);
+    codec2_destroy(c.c2);
+
+    for (engine = CODEC2_SYNTH_FFT; engine <= CODEC2_SYNTH_OSC; engine++) {
+        if (!bench_selected(names[engine], argc, argv))
+            continue;
+
+        c.c2 = codec2_create(CODEC2_MODE_1400);
+        codec2_set_synth_engine(c.c2, engine);
+        c.frame = 0;
+        bench_run(names[engine], codec2_decode_fn, &c, (double)c.spf/BENCH_FS);
+        codec2_destroy(c.c2);
+
+        c.c2 = codec2_create(CODEC2_MODE_1400);
+        codec2_set_synth_engine(c.c2, CODEC2_SYNTH_FFT);
+        for (i = 0; i < c.nframes; i++)
+            codec2_decode(c.c2, &ref[i*c.spf], &c.bits[i*c.bytes]);
+        codec2_destroy(c.c2);
+
+        c.c2 = codec2_create(CODEC2_MODE_1400);
+        codec2_set_synth_engine(c.c2, engine);
+        for (i = 0; i < c.nframes; i++)
+            codec2_decode(c.c2, &out[i*c.spf], &c.bits[i*c.bytes]);
+        codec2_destroy(c.c2);
+
+        sig = noise = 0.0;
+        max_err = 0;
+        for (i = 0; i < c.nframes*c.spf; i++) {
+            d = out[i] - ref[i];
+            sig += (double)ref[i]*ref[i];
+            noise += d*d;
+            if (abs(out[i] - ref[i]) > max_err)
+                max_err = abs(out[i] - ref[i]);
+        }
+        printf("{\"synth\":\"%s\",\"ref\":\"synth_fft\",\"max_err\":%d,"
+               "\"snr_db\":%.1f}\n", names[engine], max_err,
+               noise > 0.0 ? 10.0*log10(sig/noise) : 999.0);
+    }
+
+    free(c.bits);
+}
+
+/* random phases ------------------------------------------------------*/
+
+struct rand_ctx {
+    struct PRNG prng;
+    float       u[MAX_AMP];
+};
+
+static void libc_rand_fn(void *p) {
+    struct rand_ctx *c = p;
+    int i;
+
+    for (i = 0; i < MAX_AMP; i++)
+        c->u[i] = (float)rand()/RAND_MAX;
+}
+
+static void prng_uniform_fn(void *p) {
+    struct rand_ctx *c = p;
+
+    prng_uniform(&c->prng, c->u, MAX_AMP);
+}
+
+/* one unvoiced frame's worth of phases, the old rand() and the PRNG */
+static void bench_rand(int argc, char *argv[]) {
+    struct rand_ctx c;
+
+    prng_seed(&c.prng, 1);
+    if (bench_selected("libc_rand_80", argc, argv))
+        bench_run("libc_rand_80", libc_rand_fn, &c, 0);
+    if (bench_selected("prng_uniform_80", argc, argv))
+        bench_run("prng_uniform_80", prng_uniform_fn, &c, 0);
+}
+
+/* pitch estimators ----------------------------------------------------*/
+
+#define GROSS_ERR 0.2   /* relative F0 error counted as a gross error */
+
+struct pitch_ctx {
+    const struct PITCH_ENGINE *pe;
+    void   *state;
+    float   Sn[M];
+    float   w[M];
+    COMP    W[FFT_ENC];
+    COMP    Sw[FFT_ENC];
+    float   prev_Wo;
+    float   f0;
+    int     pos;
+};
+
+static void pitch_fn(void *p) {
+    struct pitch_ctx *c = p;
+    float pitch;
+    int i;
+
+    for (i = 0; i < M-N; i++)
+        c->Sn[i] = c->Sn[i+N];
+    for (i = 0; i < N; i++)
+        c->Sn[M-N+i] = speech[c->pos + i];
+    c->pos = (c->pos + N) % (SPEECH_LEN - N);
+
+    c->f0 = c->pe->estimate(c->state, c->Sn, N, M, P_MIN, P_MAX, &pitch,
+                            c->Sw, c->W, &c->prev_Wo);
+    c->prev_Wo = TWO_PI/pitch;
+}
+
+static void pitch_init(struct pitch_ctx *c, int engine) {
+    kiss_fft_cfg fft_fwd_cfg;
+
+    memset(c, 0, sizeof(*c));
+    fft_fwd_cfg = kiss_fft_alloc(FFT_ENC, 0, NULL, NULL);
+    make_analysis_window(fft_fwd_cfg, c->w, c->W);
+    kiss_fft_free(fft_fwd_cfg);
+    c->pe = pitch_engine(engine);
+    c->state = c->pe->create();
+    c->prev_Wo = TWO_PI/P_MAX;
+}
+
+/*
+ * F0 track of one pass through speech[], for the frames whose analysis
+ * window is well inside a syllable of bench_speech(). With a corpus
+ * every frame is returned, voicing is not known.
+ */
+static int pitch_track(int engine, float f0[], float ref[], int corpus) {
+    struct pitch_ctx c;
+    float env_a, env_b;
+    int nframes = (SPEECH_LEN - N)/N;
+    int frame, centre, n = 0;
+
+    pitch_init(&c, engine);
+    for (frame = 0; frame < nframes; frame++) {
+        pitch_fn(&c);
+        if (frame < M/N)
+            continue;
+        centre = (frame + 1)*N - M/2;
+        if (!corpus) {
+            bench_speech_f0(centre - M/4, &env_a);
+            bench_speech_f0(centre + M/4, &env_b);
+            if (env_a < 0.3f || env_b < 0.3f)
+                continue;
+            ref[n] = bench_speech_f0(centre, NULL);
+        }
+        f0[n++] = c.f0;
+    }
+    c.pe->destroy(c.state);
+
+    return n;
+}
+
+/*
+ * CPU per call for each engine, then gross error rate (more than
+ * GROSS_ERR off) and mean error of the rest, against the known F0 of
+ * bench_speech() or, with a BENCH_SPEECH corpus, against nlp().
+ */
+static void bench_pitch(int argc, char *argv[], int corpus) {
+    static float f0[SPEECH_LEN/N], ref[SPEECH_LEN/N];
+    struct pitch_ctx c;
+    const struct PITCH_ENGINE *pe;
+    float err, fine;
+    int engine, n, i, gross;
+
+    for (engine = 0; (pe = pitch_engine(engine)) != NULL; engine++) {
+        if (!bench_selected(pe->name, argc, argv) &&
+            !bench_selected("pitch", argc, argv))
+            continue;
+
+        pitch_init(&c, engine);
+        bench_run(pe->name, pitch_fn, &c, (double)N/BENCH_FS);
+        pe->destroy(c.state);
+
+        if (corpus)
+            pitch_track(CODEC2_PITCH_NLP, ref, NULL, corpus);
+        n = pitch_track(engine, f0, ref, corpus);
+        gross = 0;
+        fine = 0.0f;
+        for (i = 0; i < n; i++) {
+            err = fabsf(f0[i] - ref[i]);
+            if (err > GROSS_ERR*ref[i])
+                gross++;
+            else
+                fine += err;
+        }
+        printf("{\"pitch\":\"%s\",\"ref\":\"%s\",\"frames\":%d,"
+               "\"gross_err_pct\":%.2f,\"fine_err_hz\":%.2f}\n",
+               pe->name, corpus ? "nlp" : "synthetic", n,
+               n ? 100.0*gross/n : 0.0, n - gross ? fine/(n - gross) : 0.0);
+    }
+}
+
+/* VQ searches ---------------------------------------------------------*/
+
+#define NVEC 200
+
+struct vq_ctx {
+    float lsps[NVEC][LPC_ORD];
+    float e[NVEC];
+    float xq[2];
+    int   i;
+};
+
+static void lsps_scalar_fn(void *p) {
+    struct vq_ctx *c = p;
+    int indexes[LPC_ORD];
+
+    encode_lsps_scalar(indexes, c->lsps[c->i], LPC_ORD);
+    c->i = (c->i + 1) % NVEC;
+}
+
+static void lsps_vq_fn(void *p) {
+    struct vq_ctx *c = p;
+    int   indexes[LPC_ORD];
+    float xq[LPC_ORD];
+
+    encode_lsps_vq(indexes, c->lsps[c->i], xq, LPC_ORD);
+    c->i = (c->i + 1) % NVEC;
+}
+
+static void WoE_fn(void *p) {
+    struct vq_ctx *c = p;
+    MODEL model;
+
+    model.Wo = TWO_PI/(P_MIN + (c->i*7) % (P_MAX - P_MIN));
+    model.L  = PI/model.Wo;
+    encode_WoE(&model, c->e[c->i], c->xq);
+    c->i = (c->i + 1) % NVEC;
+}
+
+static void bench_vq(int argc, char *argv[]) {
+    struct vq_ctx c;
+    kiss_fft_cfg fft_fwd_cfg;
+    float Sn[M], w[M], ak[LPC_ORD+1];
+    COMP  W[FFT_ENC];
+    int   i, j;
+
+    memset(&c, 0, sizeof(c));
+    quantise_init();
+
+    /* real LSP vectors from the test signal */
+    fft_fwd_cfg = kiss_fft_alloc(FFT_ENC, 0, NULL, NULL);
+    make_analysis_window(fft_fwd_cfg, w, W);
+    for (i = 0; i < NVEC; i++) {
+        for (j = 0; j < M; j++)
+            Sn[j] = speech[(i*2*N + j) % SPEECH_LEN];
+        c.e[i] = speech_to_uq_lsps(c.lsps[i], ak, Sn, w, LPC_ORD, NULL);
+    }
+    kiss_fft_free(fft_fwd_cfg);
+
+    /* 1400 and 1200 send one set of LSPs per 40ms and Wo/E every 20ms */
+    if (bench_selected("vq_lsps_scalar", argc, argv))
+        bench_run("vq_lsps_scalar", lsps_scalar_fn, &c, 0.04);
+    if (bench_selected("vq_lsps_jvm", argc, argv))
+        bench_run("vq_lsps_jvm", lsps_vq_fn, &c, 0.04);
+    if (bench_selected("vq_WoE", argc, argv))
+        bench_run("vq_WoE", WoE_fn, &c, 0.02);
+}
+
+/* LPC analysis --------------------------------------------------------*/
+
+struct lpc_ctx {
+    float Sn[NVEC][M];
+    float w[M];
+    float ak[LPC_ORD+1];
+    int   i;
+    float sink;
+};
+
+/* the front of speech_to_uq_lsps(), windowed autocorrelation and
+   Levinson-Durbin */
+static void lpc_analysis_fn(void *p) {
+    struct lpc_ctx *c = p;
+    float R[LPC_ORD+1];
+
+    autocorrelate_windowed(c->Sn[c->i], c->w, R, M, LPC_ORD);
+    levinson_durbin(R, c->ak, LPC_ORD);
+    c->sink += c->ak[1];
+    c->i = (c->i + 1) % NVEC;
+}
+
+static void bench_lpc(int argc, char *argv[]) {
+    struct lpc_ctx *c;
+    kiss_fft_cfg fft_fwd_cfg;
+    COMP  W[FFT_ENC];
+    int   i, j;
+
+    if (!bench_selected("lpc_analysis", argc, argv))
+        return;
+    c = calloc(1, sizeof(*c));
+    assert(c != NULL);
+    fft_fwd_cfg = kiss_fft_alloc(FFT_ENC, 0, NULL, NULL);
+    make_analysis_window(fft_fwd_cfg, c->w, W);
+    kiss_fft_free(fft_fwd_cfg);
+    for (i = 0; i < NVEC; i++)
+        for (j = 0; j < M; j++)
+            c->Sn[i][j] = speech[(i*2*N + j) % SPEECH_LEN];
+
+    bench_run("lpc_analysis", lpc_analysis_fn, c, 0.02);
+    free(c);
+}
+
+/* LSP root finding ----------------------------------------------------*/
+
+struct lsp_ctx {
+    float ak[NVEC][LPC_ORD+1];
+    float seed[LPC_ORD];
+    int   i;
+    int   failed;
+};
+
+static void lsp_grid_fn(void *p) {
+    struct lsp_ctx *c = p;
+    float lsp[LPC_ORD];
+
+    c->failed |= lpc_to_lsp(c->ak[c->i], LPC_ORD, lsp, 5, 0.01, NULL) != LPC_ORD;
+    c->i = (c->i + 1) % NVEC;
+}
+
+static void lsp_seeded_fn(void *p) {
+    struct lsp_ctx *c = p;
+    float lsp[LPC_ORD];
+
+    c->failed |= lpc_to_lsp(c->ak[c->i], LPC_ORD, lsp, 5, 0.01, c->seed) != LPC_ORD;
+    c->i = (c->i + 1) % NVEC;
+}
+
+/* successive 20ms frames, as the 1400 and 1200 modes analyse them */
+static void bench_lsp(int argc, char *argv[]) {
+    struct lsp_ctx c;
+    kiss_fft_cfg fft_fwd_cfg;
+    float Sn[M], w[M], lsp[LPC_ORD];
+    COMP  W[FFT_ENC];
+    int   i, j;
+
+    memset(&c, 0, sizeof(c));
+    fft_fwd_cfg = kiss_fft_alloc(FFT_ENC, 0, NULL, NULL);
+    make_analysis_window(fft_fwd_cfg, w, W);
+    for (i = 0; i < NVEC; i++) {
+        for (j = 0; j < M; j++)
+            Sn[j] = speech[(i*2*N + j) % SPEECH_LEN];
+        speech_to_uq_lsps(lsp, c.ak[i], Sn, w, LPC_ORD, NULL);
+    }
+    kiss_fft_free(fft_fwd_cfg);
+
+    if (bench_selected("lpc_to_lsp_grid", argc, argv))
+        bench_run("lpc_to_lsp_grid", lsp_grid_fn, &c, 0.02);
+    if (bench_selected("lpc_to_lsp_seeded", argc, argv))
+        bench_run("lpc_to_lsp_seeded", lsp_seeded_fn, &c, 0.02);
+    assert(!c.failed);
+}
+
+/* varicode -------------------------------------------------------------*/
+
+#define VARICODE_CHARS 1000
+
+struct varicode_ctx {
+    short               bits[VARICODE_MAX_BITS*VARICODE_CHARS];
+    unsigned char       packed[VARICODE_MAX_BITS*VARICODE_CHARS/8 + 1];
+    int                 nbits;
+    struct VARICODE_DEC dec;
+    char                ascii[VARICODE_CHARS];
+    int                 failed;
+};
+
+static void varicode_decode_fn(void *p) {
+    struct varicode_ctx *c = p;
+
+    c->failed |= varicode_decode(&c->dec, c->ascii, c->bits, VARICODE_CHARS, c->nbits)
+        != VARICODE_CHARS;
+}
+
+static void varicode_decode_packed_fn(void *p) {
+    struct varicode_ctx *c = p;
+
+    c->failed |= varicode_decode_packed(&c->dec, c->ascii, c->packed, VARICODE_CHARS, c->nbits)
+        != VARICODE_CHARS;
+}
+
+/* per call, a recording's worth of text a character at a time */
+static void bench_varicode(int argc, char *argv[]) {
+    static const char msg[] = "CQ CQ CQ de VK5DGR, 73 and good DX. ";
+    struct varicode_ctx *c;
+    char   text[VARICODE_CHARS];
+    int    i;
+
+    c = calloc(1, sizeof(*c));
+    assert(c != NULL);
+    for (i = 0; i < VARICODE_CHARS; i++)
+        text[i] = msg[i % (sizeof(msg) - 1)];
+    c->nbits = varicode_encode(c->bits, text, VARICODE_MAX_BITS*VARICODE_CHARS, VARICODE_CHARS);
+    assert(varicode_encode_packed(c->packed, text, VARICODE_MAX_BITS*VARICODE_CHARS,
+                                  VARICODE_CHARS) == c->nbits);
+
+    if (bench_selected("varicode_decode_1000", argc, argv))
+        bench_run("varicode_decode_1000", varicode_decode_fn, c, 0);
+    if (bench_selected("varicode_decode_packed_1000", argc, argv))
+        bench_run("varicode_decode_packed_1000", varicode_decode_packed_fn, c, 0);
+    assert(!c->failed);
+    free(c);
+}
+
+/* kiss_fft ------------------------------------------------------------*/
+
+struct fft_ctx {
+    kiss_fft_cfg cfg;
+    kiss_fft_cpx in[1024];
+    kiss_fft_cpx out[1024];
+};
+
+static void fft_fn(void *p) {
+    struct fft_ctx *c = p;
+
+    kiss_fft(c->cfg, c->in, c->out);
+}
+
+static void bench_fft(int argc, char *argv[]) {
+    static const struct {
+        int         n;
+        int         inverse;
+        const char *name;
+    } ffts[] = {
+        {  512, 0, "kiss_fft_512"      },   /* codec2 analysis, nlp */
+        {  512, 1, "kiss_fft_512_inv"  },   /* codec2 synthesis     */
+        { 1024, 0, "kiss_fft_1024"     },   /* rx spectrum          */
+    };
+    struct fft_ctx c;
+    unsigned int f;
+    int i;
+
+    for (f = 0; f < sizeof(ffts)/sizeof(ffts[0]); f++) {
+        if (!bench_selected(ffts[f].name, argc, argv))
+            continue;
+        for (i = 0; i < ffts[f].n; i++) {
+            c.in[i].r = speech[i];
+            c.in[i].i = 0.0;
+        }
+        c.cfg = kiss_fft_alloc(ffts[f].n, ffts[f].inverse, NULL, NULL);
+        bench_run(ffts[f].name, fft_fn, &c, 0);
+        kiss_fft_free(c.cfg);
+    }
+}
+
+/* kernels, each level this CPU supports ---------------------------------*/
+
+struct kernel_ctx {
+    float  x[1024];
+    float  h[1024];
+    COMP   cx[1024];
+    COMP   cy[1024];
+    COMP   phase;
+    COMP   freq;
+    float  cb[2*512];
+    float  osc[4][40];  /* phasors and rotations for osc_bank */
+    float  y[160];
+    uint32_t lut[256];
+    uint32_t pix[512];
+    float  sink;
+};
+
+static void kernel_dot_fn(void *p) {
+    struct kernel_ctx *c = p;
+
+    c->sink += kernels->dot(c->x, c->h, 48);
+}
+
+static void kernel_cdot_real_fn(void *p) {
+    struct kernel_ctx *c = p;
+
+    c->sink += kernels->cdot_real(c->cx, c->h, 960).real;
+}
+
+static void kernel_cmix_fn(void *p) {
+    struct kernel_ctx *c = p;
+
+    kernels->cmix(c->cy, c->cx, &c->phase, c->freq, 160);
+}
+
+static void kernel_vq_search_fn(void *p) {
+    struct kernel_ctx *c = p;
+    float w[2] = { 1.0, 0.5 };
+
+    c->sink += kernels->vq_search(c->cb, 512, 2, &c->x[c->cy[0].real > 0.0], w, NULL);
+}
+
+static void kernel_harm_sum_fn(void *p) {
+    struct kernel_ctx *c = p;
+    float k[11], E[11];
+    int i;
+
+    /* coarse stage of hs_pitch_refinement() around a 100 sample pitch */
+    for (i = 0; i < 11; i++)
+        k[i] = FFT_ENC/(95.0f + i);
+    kernels->harm_sum(c->x, k, 11, 50, E);
+    c->sink += E[0];
+}
+
+static void kernel_osc_bank_fn(void *p) {
+    struct kernel_ctx *c = p;
+    float re[40], im[40];
+
+    /* 40 harmonics of a 100 Hz voice over a synthesise() frame */
+    memcpy(re, c->osc[0], sizeof(re));
+    memcpy(im, c->osc[1], sizeof(im));
+    kernels->osc_bank(c->y, re, im, c->osc[2], c->osc[3], 40, 160);
+    c->sink += c->y[0];
+}
+
+static void kernel_autocorr_fn(void *p) {
+    struct kernel_ctx *c = p;
+    float R[LPC_ORD+1];
+
+    kernels->autocorr(R, c->x, c->h, M, LPC_ORD+1);
+    c->sink += R[1];
+}
+
+static void kernel_colour_map_fn(void *p) {
+    struct kernel_ctx *c = p;
+
+    /* +-4 sigma across the colour map */
+    kernels->colour_map(c->pix, c->x, 512, -4.0f, 32.0f, c->lut);
+    c->sink += c->pix[0];
+}
+
+static void bench_kernels(int argc, char *argv[]) {
+    static const char *levels[] = { "scalar", "neon", "sse2", "avx2" };
+    static const struct {
+        const char *name;
+        bench_fn    fn;
+    } fns[] = {
+        { "dot_48",        kernel_dot_fn       },   /* nlp decimation filter */
+        { "cdot_real_960", kernel_cdot_real_fn },   /* rx_filter()           */
+        { "cmix_160",      kernel_cmix_fn      },   /* fdm_downconvert()     */
+        { "vq_search_512x2", kernel_vq_search_fn }, /* Wo/E quantiser        */
+        { "harm_sum_11x50", kernel_harm_sum_fn },   /* pitch refinement      */
+        { "osc_bank_40x160", kernel_osc_bank_fn },  /* synthesise()          */
+        { "autocorr_320x11", kernel_autocorr_fn },  /* LPC analysis          */
+        { "colour_map_512", kernel_colour_map_fn }, /* waterfall row         */
+    };
+    struct kernel_ctx *c;
+    char name[64];
+    const char *best;
+    unsigned int l, f;
+    int i;
+
+    c = calloc(1, sizeof(*c));
+    assert(c != NULL);
+    for (i = 0; i < 1024; i++) {
+        c->x[i] = bench_randn();
+        c->h[i] = bench_randn();
+        c->cx[i].real = bench_randn();
+        c->cx[i].imag = bench_randn();
+        c->cb[i] = bench_randn();
+    }
+    for (i = 0; i < 256; i++)
+        c->lut[i] = 0xff000000 | i*0x010101;
+    for (i = 0; i < 40; i++) {
+        c->osc[0][i] = bench_randn();
+        c->osc[1][i] = bench_randn();
+        c->osc[2][i] = cosf(TWO_PI*100.0f*(i + 1)/BENCH_FS);
+        c->osc[3][i] = sinf(TWO_PI*100.0f*(i + 1)/BENCH_FS);
+    }
+    c->phase.real = 1.0;
+    c->freq.real = cosf(0.1);
+    c->freq.imag = sinf(0.1);
+
+    kernels_init();
+    best = kernels_name();
+    for (l = 0; l < sizeof(levels)/sizeof(levels[0]); l++) {
+        if (kernels_select(levels[l]) != 0)
+            continue;
+        for (f = 0; f < sizeof(fns)/sizeof(fns[0]); f++) {
+            snprintf(name, sizeof(name), "kernel_%s_%s", fns[f].name, levels[l]);
+            if (bench_selected(name, argc, argv))
+                bench_run(name, fns[f].fn, c, 0);
+        }
+    }
+    kernels_select(best);
+
+    free(c);
+}
+
+int main(int argc, char *argv[]) {
+    int corpus;
+
+    corpus = bench_load_speech(speech, SPEECH_LEN);
+    if (!corpus)
+        bench_speech(speech, SPEECH_LEN);
+
+    kernels_init();
+    printf("{\"kernels\":\"%s\"}\n", kernels_name());
+
+    bench_fdmdv(argc, argv);
+    bench_codec2(argc, argv);
+    bench_synth(argc, argv);
+    bench_rand(argc, argv);
+    bench_pitch(argc, argv, corpus);
+    bench_vq(argc, argv);
+    bench_lpc(argc, argv);
+    bench_lsp(argc, argv);
+    bench_varicode(argc, argv);
+    bench_fft(argc, argv);
+    bench_kernels(argc, argv);
+
+    return 0;
+}
@@ -0,0 +1,491 @@
+/*
+ * End to end receive benchmark: 48 kHz stereo USB audio through
+ * resample -> fdmdv_demod -> codec2_decode, using the same
+ * rx_decode_buffer() the app runs on the USB thread.
+ *
+ * usage: bench_rx [-i modem.raw] [-o speech.raw] [-s secs] [-n snr_dB] [-b frames]
+ *                 [-c ppm] [-l ms] [-w prefix] [-r rows_per_sec] [-q secs] [-a]
+ *                 [-f ms] [-h ms]
+ *
+ *   -i  8 kHz 16 bit mono modem signal to receive, otherwise a test
+ *       signal is made by encoding synthetic speech and modulating it
+ *   -o  write the decoded 8 kHz speech here
+ *   -s  length of the generated test signal in seconds (default 20)
+ *   -n  SNR of the generated test signal in a 3 kHz bandwidth
+ *       (default 20 dB)
+ *   -b  48 kHz stereo frames passed to each rx_decode_buffer() call
+ *       (default 960, a 20 ms USB transfer)
+ *   -c  offset of the transmitter's sample clock from ours in ppm,
+ *       positive when it runs fast (default 0)
+ *   -l  target output latency of the jitter buffer in milliseconds
+ *   -w  write the waterfall to prefix_000.ppm, prefix_001.ppm, ...
+ *       each time a full image of new rows has been rendered
+ *   -r  waterfall rows per second
+ *   -q  seconds of noise alone before the generated signal starts
+ *   -a  always run the demod, no low power acquisition mode
+ *   -f  fade the generated signal out for ms, 2 s after it starts and
+ *       every 3 s after that, and report how long after each fade
+ *       the speech comes back
+ *   -h  how long the demod holds its sync through a fade, in ms
+ *
+ * Prints one JSON line for the whole run, including the text received
+ * in the data bit and the demod's final clock offset estimate, then
+ * the per-stage timing
+ * if built with PROFILE=1, the real time monitor counters and the
+ * jitter buffer statistics, and last the CPU used while idle (waiting
+ * for a pilot), acquiring and in sync. With
+ * FREEDV_KERNELS=check in the environment it also prints the result
+ * of comparing each optimised kernel with its scalar reference.
+ *
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "codec2_fdmdv.h"
+#include "codec2.h"
+#include "varicode.h"
+#include "profile.h"
+#include "kernels.h"
+
+#include "freedv_rx.h"
+#include "freedv_jni.h"
+#include "freedv_jbuf.h"
+#include "freedv_rtmon.h"
+#include "freedv_waterfall.h"
+
+#include "bench.h"
+
+#define MEM8            (FDMDV_OS_TAPS/FDMDV_OS)
+
+#define TEXT_MAX 4096
+
+/* -f fades: the first FADE_FIRST seconds into the signal, then every
+ * FADE_PERIOD seconds */
+#define FADE_FIRST      2.0f
+#define FADE_PERIOD     3.0f
+
+static FILE *fout;
+static char  text[TEXT_MAX];
+static int   ntext;
+static long  speech_samples;
+static int   sync_changes;
+static bool  in_sync;
+static float fade_ms;
+static long  signal_start;      /* 8 kHz sample the test signal starts at */
+
+/* callbacks normally implemented in freedv_jni.c */
+
+void jni_cb(const signed char *data, int len) {
+    speech_samples += len/sizeof(short);
+    if (fout)
+        fwrite(data, 1, len, fout);
+}
+
+void jni_update_sync(bool state) {
+    in_sync = state;
+    sync_changes++;
+}
+
+/* 8 kHz sample fade k of the test signal ends at. */
+static long fade_end(int k) {
+    return signal_start + (long)((FADE_FIRST + k*FADE_PERIOD + fade_ms/1000)*BENCH_FS);
+}
+
+/* Whether 8 kHz sample n of the test signal is faded out. */
+static bool in_fade(long n) {
+    long period = FADE_PERIOD*BENCH_FS, t;
+
+    t = n - signal_start - (long)(FADE_FIRST*BENCH_FS);
+    if (fade_ms <= 0.0f || t < 0)
+        return false;
+    return t % period < fade_ms*BENCH_FS/1000;
+}
+
+/*
+ * Modulate codec2 1400 frames of synthetic speech the way the FreeDV
+ * transmitter does, with a varicode text message in the spare bit.
+ * The first idle_frames frames are left as noise alone, and the signal
+ * drops out completely during fades, see in_fade(). Returns the number
+ * of 8 kHz samples written to modem[].
+ */
+static int make_test_signal(short modem[], int nframes, float snr_dB, int idle_frames) {
+    struct CODEC2 *c2 = codec2_create(CODEC2_MODE_1400);
+    struct FDMDV  *fdmdv = fdmdv_create();
+    int   spf = codec2_samples_per_frame(c2);
+    int   nbits = codec2_bits_per_frame(c2);
+    short *speech = malloc(sizeof(short)*spf*nframes);
+    unsigned char packed[7];
+    int   bits[2*FDMDV_BITS_PER_FRAME];
+    COMP  tx_fdm[FDMDV_NOM_SAMPLES_PER_FRAME];
+    char  text[] = "CQ CQ CQ de bench_rx ";
+    short varicode[VARICODE_MAX_BITS*sizeof(text)];
+    int   nvaricode, ivaricode = 0;
+    int   data_bit = codec2_get_spare_bit_index(c2);
+    int   i, j, h, sync_bit, n = 0;
+    float noise_rms;
+
+    assert(nbits == 2*FDMDV_BITS_PER_FRAME);
+    signal_start = (long)idle_frames*2*FDMDV_NOM_SAMPLES_PER_FRAME;
+    nvaricode = varicode_encode(varicode, text, sizeof(varicode)/sizeof(short), strlen(text));
+
+    /* Pilot plus NC carriers each at about 1/sqrt(2) rms once scaled,
+     * noise is measured in 3 kHz of the 4 kHz bandwidth. */
+    noise_rms = FDMDV_SCALE*sqrtf(0.5f*FDMDV_NSYM*4000.0f/3000.0f)
+        * powf(10.0f, -snr_dB/20.0f) * 0.5f;
+
+    bench_speech(speech, spf*nframes);
+    for (i = 0; i < nframes; i++) {
+        codec2_encode(c2, packed, &speech[i*spf]);
+        for (j = 0; j < nbits; j++)
+            bits[j] = (packed[j/8] >> (7 - j%8)) & 1;
+        bits[data_bit] = varicode[ivaricode];
+        ivaricode = (ivaricode + 1) % nvaricode;
+
+        for (h = 0; h < 2; h++) {
+            fdmdv_mod(fdmdv, tx_fdm, &bits[h*FDMDV_BITS_PER_FRAME], &sync_bit);
+            for (j = 0; j < FDMDV_NOM_SAMPLES_PER_FRAME; j++) {
+                float x = noise_rms*bench_randn();
+
+                if (i >= idle_frames && !in_fade(n))
+                    x += FDMDV_SCALE*tx_fdm[j].real;
+                if (x > 32767.0f) x = 32767.0f;
+                if (x < -32767.0f) x = -32767.0f;
+                modem[n++] = x;
+            }
+        }
+    }
+
+    free(speech);
+    fdmdv_destroy(fdmdv);
+    codec2_destroy(c2);
+    return n;
+}
+
+/*
+ * The modem signal as received with our sample clock when the
+ * transmitter's runs ppm fast, by cubic interpolation. Returns the
+ * number of samples written to out[], which has room for n + n/500.
+ */
+static int apply_clock_offset(short out[], const short modem[], int n, float ppm) {
+    double step = 1.0 + 1E-6*ppm, t;
+    float  x[4], f, y;
+    int    i, j, k;
+
+    for (k = 0, t = 1.0; t < n - 2; k++, t = 1.0 + k*step) {
+        i = (int)t;
+        f = t - i;
+        for (j = 0; j < 4; j++)
+            x[j] = modem[i - 1 + j];
+        y = x[1] + 0.5f*f*(x[2] - x[0] + f*(2.0f*x[0] - 5.0f*x[1] + 4.0f*x[2] - x[3]
+            + f*(3.0f*(x[1] - x[2]) + x[3] - x[0])));
+        if (y > 32767.0f) y = 32767.0f;
+        if (y < -32767.0f) y = -32767.0f;
+        out[k] = y;
+    }
+    return k;
+}
+
+/* 8 kHz mono to the 48 kHz stereo the USB codec delivers. */
+static short *to_usb_audio(short modem[], int n) {
+    short *usb = malloc(sizeof(short)*2*FDMDV_OS*n);
+    float  in8k[MEM8 + FDMDV_NOM_SAMPLES_PER_FRAME];
+    float  out48k[FDMDV_OS*FDMDV_NOM_SAMPLES_PER_FRAME];
+    int    i, j, k = 0;
+
+    memset(in8k, 0, sizeof(in8k));
+    for (i = 0; i + FDMDV_NOM_SAMPLES_PER_FRAME <= n; i += FDMDV_NOM_SAMPLES_PER_FRAME) {
+        for (j = 0; j < FDMDV_NOM_SAMPLES_PER_FRAME; j++)
+            in8k[MEM8 + j] = modem[i + j];
+        fdmdv_8_to_48(out48k, &in8k[MEM8], FDMDV_NOM_SAMPLES_PER_FRAME);
+        for (j = 0; j < FDMDV_OS*FDMDV_NOM_SAMPLES_PER_FRAME; j++) {
+            usb[k++] = out48k[j];
+            usb[k++] = out48k[j];
+        }
+    }
+    return usb;
+}
+
+/* JSON string, the text is 7 bit but may have control characters */
+static void print_json_string(const char *s, int n) {
+    int i;
+
+    putchar('"');
+    for (i = 0; i < n; i++) {
+        if (s[i] == '"' || s[i] == '\\')
+            printf("\\%c", s[i]);
+        else if ((unsigned char)s[i] < 0x20)
+            printf("\\u%04x", s[i]);
+        else
+            putchar(s[i]);
+    }
+    putchar('"');
+}
+
+static void print_profile(void) {
+    struct PROFILE_STATS s;
+    int i;
+
+    if (!profile_enabled())
+        return;
+    for (i = 0; i < PROFILE_NUM_STAGES; i++) {
+        profile_get_stats(i, &s);
+        if (s.count == 0)
+            continue;
+        printf("{\"stage\":\"%s\",\"count\":%lu,\"mean_us\":%.2f,\"p50_us\":%.2f,"
+               "\"p99_us\":%.2f,\"max_us\":%.2f,\"worst_us\":%.2f}\n",
+               profile_stage_name(i), s.count, s.mean_us, s.p50_us,
+               s.p99_us, s.max_us, s.worst_us);
+    }
+}
+
+static void print_rtmon(void) {
+    struct rtmon_stats s;
+
+    rtmon_snapshot(&s);
+    printf("{\"rtmon\":{\"callbacks\":%u,\"deliveries\":%u,\"overruns\":%u,"
+           "\"underruns\":%u,\"late_frames\":%u,\"deadline_misses\":%u,"
+           "\"decode_mean_us\":%.1f,\"decode_max_us\":%.1f,"
+           "\"queue_depth_min\":%d,\"queue_depth_max\":%d}}\n",
+           s.callbacks, s.deliveries, s.overruns, s.underruns, s.late_frames,
+           s.deadline_misses, s.decode_mean_us, s.decode_max_us,
+           s.queue_depth_min, s.queue_depth_max);
+}
+
+static void print_jbuf(void) {
+    struct jbuf_stats s;
+
+    jbuf_snapshot(&s);
+    printf("{\"jbuf\":{\"latency_ms\":%.1f,\"target_ms\":%.1f,\"jitter_ms\":%.1f,"
+           "\"rate_ppm\":%.0f,\"blocks\":%u,\"concealed\":%u,\"stretched\":%u,"
+           "\"compressed\":%u,\"dropped\":%u}}\n",
+           s.latency_ms, s.target_ms, s.jitter_ms, s.rate_ppm, s.blocks,
+           s.concealed, s.stretched, s.compressed, s.dropped);
+}
+
+/* The waterfall as it would be blitted, as a binary PPM. */
+static int dump_waterfall(const char *prefix, int n) {
+    const uint32_t *image = waterfall_image(NULL);
+    unsigned char rgb[3*WATERFALL_WIDTH];
+    char name[256];
+    FILE *f;
+    int rows, i, j;
+
+    waterfall_pixels(&rows);
+    snprintf(name, sizeof(name), "%s_%03d.ppm", prefix, n);
+    f = fopen(name, "wb");
+    if (!f) {
+        perror(name);
+        return -1;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", WATERFALL_WIDTH, rows);
+    for (i = 0; i < rows; i++, image += WATERFALL_WIDTH) {
+        for (j = 0; j < WATERFALL_WIDTH; j++) {
+            /* bytes R, G, B, A */
+            memcpy(&rgb[3*j], &image[j], 3);
+        }
+        fwrite(rgb, 1, sizeof(rgb), f);
+    }
+    fclose(f);
+    return 0;
+}
+
+static void print_kernels_check(void) {
+    struct KERNELS_CHECK_STATS s;
+    int i;
+
+    if (!kernels_checking())
+        return;
+    for (i = 0; kernels_check_stats(i, &s); i++)
+        printf("{\"kernel_check\":\"%s\",\"calls\":%lu,\"failures\":%lu,"
+               "\"max_err\":%.3g}\n", s.name, s.calls, s.failures, s.max_err);
+}
+
+int main(int argc, char *argv[]) {
+    const char *in_name = NULL, *out_name = NULL;
+    float  secs = 20.0f, snr_dB = 20.0f, ppm = 0.0f;
+    int    latency_ms = -1;
+    const char *waterfall_prefix = NULL;
+    float  waterfall_rate = 0.0f;
+    unsigned int waterfall_head;
+    int    waterfall_rows, nimages = 0;
+    float  idle_secs = 0.0f;
+    int    low_power = 1, was_idle = 0, wakeups = 0, synced_call = -1;
+    double t, call_secs, mode_secs[3] = { 0 }, mode_audio[3] = { 0 };
+    int    hold_ms = -1, fade = 0, nfades = 0, relocked = 0;
+    long   pos;
+    double relock_ms, relock_sum = 0.0, relock_max = 0.0;
+    short *modem, *usb;
+    int    n, nframes, i, mode, opt, block = FDMDV_OS*FDMDV_NOM_SAMPLES_PER_FRAME, ncalls, nusb, len;
+    double start, elapsed;
+    struct rx_telemetry telemetry;
+
+    while ((opt = getopt(argc, argv, "i:o:s:n:b:c:l:w:r:q:af:h:")) != -1) {
+        switch (opt) {
+        case 'i': in_name = optarg; break;
+        case 'o': out_name = optarg; break;
+        case 's': secs = atof(optarg); break;
+        case 'n': snr_dB = atof(optarg); break;
+        case 'b': block = atoi(optarg); break;
+        case 'c': ppm = atof(optarg); break;
+        case 'l': latency_ms = atoi(optarg); break;
+        case 'w': waterfall_prefix = optarg; break;
+        case 'r': waterfall_rate = atof(optarg); break;
+        case 'q': idle_secs = atof(optarg); break;
+        case 'a': low_power = 0; break;
+        case 'f': fade_ms = atof(optarg); break;
+        case 'h': hold_ms = atoi(optarg); break;
+        default:
+            fprintf(stderr, "usage: %s [-i modem.raw] [-o speech.raw] [-s secs] [-n snr_dB] [-b frames] [-c ppm] [-l ms] [-w prefix] [-r rows_per_sec] [-q secs] [-a] [-f ms] [-h ms]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (in_name) {
+        FILE *fin = fopen(in_name, "rb");
+        long size;
+
+        if (!fin) {
+            perror(in_name);
+            return 1;
+        }
+        fseek(fin, 0, SEEK_END);
+        size = ftell(fin);
+        fseek(fin, 0, SEEK_SET);
+        modem = malloc(size);
+        n = fread(modem, sizeof(short), size/sizeof(short), fin);
+        fclose(fin);
+    } else {
+        /* 40 ms codec frames */
+        n = (int)((idle_secs + secs)*BENCH_FS);
+        modem = malloc(sizeof(short)*n);
+        n = make_test_signal(modem, n/(2*FDMDV_NOM_SAMPLES_PER_FRAME), snr_dB,
+                (int)(idle_secs*BENCH_FS)/(2*FDMDV_NOM_SAMPLES_PER_FRAME));
+    }
+    if (out_name && !(fout = fopen(out_name, "wb"))) {
+        perror(out_name);
+        return 1;
+    }
+
+    if (block < 1) {
+        fprintf(stderr, "%s: -b must be at least 1\n", argv[0]);
+        return 1;
+    }
+    if (fabsf(ppm) > 1000.0f) {
+        fprintf(stderr, "%s: -c must be within +/- 1000 ppm\n", argv[0]);
+        return 1;
+    }
+    if (ppm != 0.0f) {
+        short *rx = malloc(sizeof(short)*(n + n/500));
+
+        n = apply_clock_offset(rx, modem, n, ppm);
+        free(modem);
+        modem = rx;
+    }
+    usb = to_usb_audio(modem, n);
+    nframes = n/FDMDV_NOM_SAMPLES_PER_FRAME;
+    nusb = nframes*FDMDV_OS*FDMDV_NOM_SAMPLES_PER_FRAME;    /* stereo frames */
+    ncalls = 0;
+
+    freedv_create();
+    if (latency_ms >= 0)
+        jbuf_set_target_ms(latency_ms);
+    if (waterfall_rate > 0.0f)
+        waterfall_set_rate(waterfall_rate);
+    waterfall_pixels(&waterfall_rows);
+    rx_set_low_power(low_power);
+    if (hold_ms >= 0)
+        rx_set_fade_hold_ms(hold_ms);
+    if (in_name)
+        fade_ms = 0.0f;
+    if (fade_ms > 0.0f)
+        while (fade_end(nfades) + (long)(FADE_PERIOD*BENCH_FS) - (long)(fade_ms*BENCH_FS/1000) <= n)
+            nfades++;
+    profile_reset();
+    kernels_check_reset();
+    elapsed = 0.0;
+    for (i = 0; i < nusb; i += block) {
+        len = nusb - i < block ? nusb - i : block;
+        start = bench_now();
+        rx_decode_buffer(&usb[2*i], 2*len*sizeof(short));
+        t = bench_now() - start;
+        elapsed += t;
+        ntext += rx_get_text(&text[ntext], TEXT_MAX - ntext);
+        ncalls++;
+
+        /* which mode the receiver was in for this call */
+        rx_telemetry_snapshot(&telemetry);
+        call_secs = (double)len/(FDMDV_OS*BENCH_FS);
+        mode = telemetry.idle ? 0 : telemetry.sync ? 2 : 1;
+        mode_secs[mode] += t;
+        mode_audio[mode] += call_secs;
+        if (was_idle && !telemetry.idle)
+            wakeups++;
+        was_idle = telemetry.idle;
+        if (telemetry.sync && synced_call < 0 &&
+            i >= idle_secs*FDMDV_OS*BENCH_FS)
+            synced_call = i;
+
+        /* time from the end of the fade to speech, or lost until the
+           next fade */
+        pos = (i + len)/FDMDV_OS;
+        if (fade < nfades && pos >= fade_end(fade)) {
+            relock_ms = 1000.0*(pos - fade_end(fade))/BENCH_FS;
+            if (telemetry.sync) {
+                relocked++;
+                relock_sum += relock_ms;
+                if (relock_ms > relock_max)
+                    relock_max = relock_ms;
+                fade++;
+            } else if (pos >= fade_end(fade + 1) - (long)(fade_ms*BENCH_FS/1000)) {
+                fade++;
+            }
+        }
+        if (waterfall_prefix) {
+            waterfall_image(&waterfall_head);
+            if (waterfall_head >= (unsigned int)(nimages + 1)*waterfall_rows &&
+                dump_waterfall(waterfall_prefix, nimages++) != 0)
+                return 1;
+        }
+    }
+    rx_telemetry_snapshot(&telemetry);
+
+    printf("{\"bench\":\"rx_e2e\",\"iters\":%d,\"ns_per_call\":%.1f,\"rtf\":%.6f,"
+           "\"speech_secs\":%.2f,\"sync\":%s,\"sync_changes\":%d,"
+           "\"clock_offset_ppm\":%.1f,\"text\":",
+           ncalls, 1E9*elapsed/ncalls, elapsed/(nframes*0.02),
+           (float)speech_samples/BENCH_FS, in_sync ? "true" : "false",
+           sync_changes, telemetry.clock_offset);
+    print_json_string(text, ntext);
+    printf("}\n");
+    print_profile();
+    print_rtmon();
+    print_jbuf();
+    printf("{\"acq\":{\"low_power\":%s,\"idle_secs\":%.1f,\"idle_rtf\":%.6f,"
+           "\"acquiring_secs\":%.1f,\"acquiring_rtf\":%.6f,"
+           "\"locked_secs\":%.1f,\"locked_rtf\":%.6f,\"wakeups\":%d,"
+           "\"time_to_sync_ms\":%.0f}}\n",
+           low_power ? "true" : "false",
+           mode_audio[0], mode_audio[0] > 0 ? mode_secs[0]/mode_audio[0] : 0.0,
+           mode_audio[1], mode_audio[1] > 0 ? mode_secs[1]/mode_audio[1] : 0.0,
+           mode_audio[2], mode_audio[2] > 0 ? mode_secs[2]/mode_audio[2] : 0.0,
+           wakeups, synced_call < 0 ? -1.0 :
+           1000.0*(synced_call/(double)(FDMDV_OS*BENCH_FS) - idle_secs));
+    if (fade_ms > 0.0f)
+        printf("{\"fade\":{\"fade_ms\":%.0f,\"fades\":%d,\"relocked\":%d,"
+               "\"mean_ms\":%.0f,\"max_ms\":%.0f}}\n", fade_ms, nfades, relocked,
+               relocked ? relock_sum/relocked : 0.0, relock_max);
+    print_kernels_check();
+
+    fdmdv_close();
+    if (fout)
+        fclose(fout);
+    free(usb);
+    free(modem);
+    return 0;
+}
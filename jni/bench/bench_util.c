@@ -0,0 +1,183 @@
+/*
+ * Host benchmark helpers, see bench.h.
+ *
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#include "bench.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+double bench_now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1E-9*ts.tv_nsec;
+}
+
+double bench_min_secs(void) {
+    const char *s = getenv("BENCH_SECS");
+
+    if (s && atof(s) > 0)
+        return atof(s);
+    return 0.5;
+}
+
+unsigned long long bench_cycles(void) {
+#if defined(__i386__) || defined(__x86_64__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static void report(const char *name, long iters, double secs, double audio_secs,
+                   unsigned long long cycles) {
+    double ns = 1E9*secs/iters;
+
+    printf("{\"bench\":\"%s\",\"iters\":%ld,\"ns_per_call\":%.1f", name, iters, ns);
+    if (cycles)
+        printf(",\"cycles_per_call\":%.0f", (double)cycles/iters);
+    if (audio_secs > 0)
+        printf(",\"rtf\":%.6f", secs/(iters*audio_secs));
+    printf("}\n");
+    fflush(stdout);
+}
+
+void bench_report(const char *name, long iters, double secs, double audio_secs) {
+    report(name, iters, secs, audio_secs, 0);
+}
+
+void bench_run(const char *name, bench_fn fn, void *ctx, double audio_secs) {
+    double min_secs = bench_min_secs();
+    double start, elapsed;
+    unsigned long long cycles;
+    long   iters = 0, batch = 1, i;
+
+    /* warm up caches and any lazily built tables */
+    fn(ctx);
+
+    cycles = bench_cycles();
+    start = bench_now();
+    do {
+        for (i = 0; i < batch; i++)
+            fn(ctx);
+        iters += batch;
+        if (batch < 1024)
+            batch *= 2;
+        elapsed = bench_now() - start;
+    } while (elapsed < min_secs);
+    cycles = bench_cycles() - cycles;
+
+    report(name, iters, elapsed, audio_secs, cycles);
+}
+
+int bench_selected(const char *name, int argc, char *argv[]) {
+    int i;
+
+    if (argc < 2)
+        return 1;
+    for (i = 1; i < argc; i++)
+        if (strstr(name, argv[i]))
+            return 1;
+    return 0;
+}
+
+static unsigned int rand_state = 12345;
+
+static float bench_randu(void) {
+    rand_state = rand_state*1103515245 + 12345;
+    return ((rand_state >> 8) + 0.5f)/16777216.0f;
+}
+
+float bench_randn(void) {
+    float u1 = bench_randu(), u2 = bench_randu();
+
+    return sqrtf(-2.0f*logf(u1))*cosf(2.0f*M_PI*u2);
+}
+
+/* two pole resonator */
+static float resonate(float x, float mem[], float f, float bw) {
+    float r = expf(-M_PI*bw/BENCH_FS);
+    float y = x + 2.0f*r*cosf(2.0f*M_PI*f/BENCH_FS)*mem[0] - r*r*mem[1];
+
+    mem[1] = mem[0];
+    mem[0] = y;
+    return y;
+}
+
+float bench_speech_f0(int i, float *env) {
+    float t = (float)i/BENCH_FS;
+
+    /* roughly four syllables a second with short pauses */
+    if (env != NULL) {
+        *env = sinf(2.0f*M_PI*2.0f*t);
+        *env = *env > 0.0f ? *env : 0.0f;
+    }
+    return 140.0f + 50.0f*sinf(2.0f*M_PI*0.7f*t);
+}
+
+void bench_speech(short speech[], int n) {
+    float f1_mem[2] = {0, 0}, f2_mem[2] = {0, 0};
+    float phase = 0.0f, t, f0, f1, f2, env, x, y;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        t  = (float)i/BENCH_FS;
+        f0 = bench_speech_f0(i, &env);
+        f1 = 600.0f + 250.0f*sinf(2.0f*M_PI*1.3f*t);
+        f2 = 1600.0f + 500.0f*sinf(2.0f*M_PI*0.9f*t + 1.0f);
+
+        phase += f0/BENCH_FS;
+        x = 0.0f;
+        if (phase >= 1.0f) {
+            phase -= 1.0f;
+            x = 1.0f;
+        }
+        x += 0.02f*bench_randn();
+
+        y = resonate(x, f1_mem, f1, 80.0f);
+        y = resonate(0.05f*y, f2_mem, f2, 120.0f);
+        y = 2000.0f*env*y + 10.0f*bench_randn();
+        if (y > 32767.0f) y = 32767.0f;
+        if (y < -32767.0f) y = -32767.0f;
+        speech[i] = y;
+    }
+}
+
+int bench_load_speech(short speech[], int n) {
+    const char *path = getenv("BENCH_SPEECH");
+    FILE *f;
+    int got, i;
+
+    if (path == NULL || *path == 0)
+        return 0;
+    f = fopen(path, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "bench: can't open BENCH_SPEECH %s\n", path);
+        exit(1);
+    }
+    got = fread(speech, sizeof(short), n, f);
+    fclose(f);
+    if (got <= 0) {
+        fprintf(stderr, "bench: BENCH_SPEECH %s is empty\n", path);
+        exit(1);
+    }
+
+    /* repeat a short corpus to fill the buffer */
+    for (i = got; i < n; i++)
+        speech[i] = speech[i - got];
+
+    return 1;
+}
@@ -35,6 +35,8 @@
 #include "defines.h"
 #include "sine.h"
 #include "nlp.h"
+#include "yin.h"
+#include "pitch.h"
 #include "dump.h"
 #include "lpc.h"
 #include "quantise.h"
@@ -43,7 +45,22 @@
 #include "postfilter.h"
 #include "codec2.h"
 #include "lsp.h"
+#include "prng.h"
 #include "codec2_internal.h"
+#include "profile.h"
+#include "kernels.h"
+
+/* synthesis engine of new instances, can be overridden at build time
+   with e.g. -DCODEC2_SYNTH_DEFAULT=CODEC2_SYNTH_FFT */
+
+#ifndef CODEC2_SYNTH_DEFAULT
+#define CODEC2_SYNTH_DEFAULT CODEC2_SYNTH_FFTR
+#endif
+
+/* seed of new instances, so a given bit stream always decodes to the
+   same speech, see codec2_set_rand_seed() */
+
+#define CODEC2_RAND_SEED 1
 
 /*---------------------------------------------------------------------------*\
                                                        
@@ -92,6 +109,8 @@ struct CODEC2 * CODEC2_WIN32SUPPORT codec2_create(int mode)
     c2 = (struct CODEC2*)malloc(sizeof(struct CODEC2));
     if (c2 == NULL)
 	return NULL;
+
+    kernels_init();
     
     assert(
 	   (mode == CODEC2_MODE_3200) || 
@@ -107,12 +126,18 @@ struct CODEC2 * CODEC2_WIN32SUPPORT codec2_create(int mode)
 	c2->Sn_[i] = 0;
     c2->fft_fwd_cfg = kiss_fft_alloc(FFT_ENC, 0, NULL, NULL);
     make_analysis_window(c2->fft_fwd_cfg, c2->w,c2->W);
+    c2->fftr_fwd_cfg = kiss_fftr_alloc(FFT_ENC, 0, NULL, NULL);
     make_synthesis_window(c2->Pn);
     c2->fft_inv_cfg = kiss_fft_alloc(FFT_DEC, 1, NULL, NULL);
+    c2->fftr_inv_cfg = kiss_fftr_alloc(FFT_DEC, 1, NULL, NULL);
+    c2->synth_engine = CODEC2_SYNTH_DEFAULT;
     quantise_init();
     c2->prev_Wo_enc = 0.0;
+    for(i=0; i<LPC_ORD; i++)
+	c2->lsp_x_enc[i] = 0.0;
     c2->bg_est = 0.0;
     c2->ex_phase = 0.0;
+    prng_seed(&c2->prng, CODEC2_RAND_SEED);
 
     for(l=1; l<=MAX_AMP; l++)
 	c2->prev_model_dec.A[l] = 0.0;
@@ -125,8 +150,10 @@ struct CODEC2 * CODEC2_WIN32SUPPORT codec2_create(int mode)
     }
     c2->prev_e_dec = 1;
 
-    c2->nlp = nlp_create();
-    if (c2->nlp == NULL) {
+    c2->pitch_engine_id = CODEC2_PITCH_NLP;
+    c2->pitch_engine = pitch_engine(c2->pitch_engine_id);
+    c2->pitch_state = c2->pitch_engine->create();
+    if (c2->pitch_state == NULL) {
 	free (c2);
 	return NULL;
     }
@@ -152,9 +179,11 @@ struct CODEC2 * CODEC2_WIN32SUPPORT codec2_create(int mode)
 void CODEC2_WIN32SUPPORT codec2_destroy(struct CODEC2 *c2)
 {
     assert(c2 != NULL);
-    nlp_destroy(c2->nlp);
+    c2->pitch_engine->destroy(c2->pitch_state);
     KISS_FFT_FREE(c2->fft_fwd_cfg);
+    KISS_FFT_FREE(c2->fftr_fwd_cfg);
     KISS_FFT_FREE(c2->fft_inv_cfg);
+    KISS_FFT_FREE(c2->fftr_inv_cfg);
     free(c2);
 }
 
@@ -299,7 +328,7 @@ void codec2_encode_3200(struct CODEC2 *c2, unsigned char * bits, short speech[])
     Wo_index = encode_Wo(model.Wo);
     pack(bits, &nbit, Wo_index, WO_BITS);
    
-    e = speech_to_uq_lsps(lsps, ak, c2->Sn, c2->w, LPC_ORD);
+    e = speech_to_uq_lsps(lsps, ak, c2->Sn, c2->w, LPC_ORD, c2->lsp_x_enc);
     e_index = encode_energy(e);
     pack(bits, &nbit, e_index, E_BITS);
 
@@ -333,6 +362,7 @@ void codec2_decode_3200(struct CODEC2 *c2, short speech[], const unsigned char *
     float   ak[2][LPC_ORD+1];
     int     i,j;
     unsigned int nbit = 0;
+    PROFILE_VAR(t);
 
     assert(c2 != NULL);
     
@@ -347,19 +377,21 @@ void codec2_decode_3200(struct CODEC2 *c2, short speech[], const unsigned char *
     /* this will partially fill the model params for the 2 x 10ms
        frames */
 
+    PROFILE_SAMPLE(t);
     model[0].voiced = unpack(bits, &nbit, 1);
     model[1].voiced = unpack(bits, &nbit, 1);
-
     Wo_index = unpack(bits, &nbit, WO_BITS);
-    model[1].Wo = decode_Wo(Wo_index);
-    model[1].L  = PI/model[1].Wo;
-
     e_index = unpack(bits, &nbit, E_BITS);
-    e[1] = decode_energy(e_index);
-
     for(i=0; i<LSPD_SCALAR_INDEXES; i++) {
 	lspd_indexes[i] = unpack(bits, &nbit, lspd_bits(i));
     }
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_UNPACK);
+
+    model[1].Wo = decode_Wo(Wo_index);
+    model[1].L  = PI/model[1].Wo;
+    e[1] = decode_energy(e_index);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_DECODE_WOE);
+
     decode_lspds_scalar(&lsps[1][0], lspd_indexes, LPC_ORD);
  
     /* interpolate ------------------------------------------------*/
@@ -374,12 +406,15 @@ void codec2_decode_3200(struct CODEC2 *c2, short speech[], const unsigned char *
        between, then recover spectral amplitudes */
 
     interpolate_lsp_ver2(&lsps[0][0], c2->prev_lsps_dec, &lsps[1][0], 0.5);
-    for(i=0; i<2; i++) {
+    for(i=0; i<2; i++)
 	lsp_to_lpc(&lsps[i][0], &ak[i][0], LPC_ORD);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_LSP_DECODE);
+    for(i=0; i<2; i++) {
 	aks_to_M2(c2->fft_fwd_cfg, &ak[i][0], LPC_ORD, &model[i], e[i], &snr, 0, 0, 
                   c2->lpc_pf, c2->bass_boost, c2->beta, c2->gamma); 
 	apply_lpc_correction(&model[i]);
     }
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_AKS_TO_M2);
 
     /* synthesise ------------------------------------------------*/
 
@@ -446,7 +481,7 @@ void codec2_encode_2400(struct CODEC2 *c2, unsigned char * bits, short speech[])
     analyse_one_frame(c2, &model, &speech[N]);
     pack(bits, &nbit, model.voiced, 1);
     
-    e = speech_to_uq_lsps(lsps, ak, c2->Sn, c2->w, LPC_ORD);
+    e = speech_to_uq_lsps(lsps, ak, c2->Sn, c2->w, LPC_ORD, c2->lsp_x_enc);
     WoE_index = encode_WoE(&model, e, c2->xq_enc);
     pack(bits, &nbit, WoE_index, WO_E_BITS);
 
@@ -481,6 +516,7 @@ void codec2_decode_2400(struct CODEC2 *c2, short speech[], const unsigned char *
     float   ak[2][LPC_ORD+1];
     int     i,j;
     unsigned int nbit = 0;
+    PROFILE_VAR(t);
 
     assert(c2 != NULL);
     
@@ -495,15 +531,20 @@ void codec2_decode_2400(struct CODEC2 *c2, short speech[], const unsigned char *
     /* this will partially fill the model params for the 2 x 10ms
        frames */
 
+    PROFILE_SAMPLE(t);
     model[0].voiced = unpack(bits, &nbit, 1);
 
     model[1].voiced = unpack(bits, &nbit, 1);
     WoE_index = unpack(bits, &nbit, WO_E_BITS);
-    decode_WoE(&model[1], &e[1], c2->xq_dec, WoE_index);
 
     for(i=0; i<LSP_SCALAR_INDEXES; i++) {
 	lsp_indexes[i] = unpack(bits, &nbit, lsp_bits(i));
     }
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_UNPACK);
+
+    decode_WoE(&model[1], &e[1], c2->xq_dec, WoE_index);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_DECODE_WOE);
+
     decode_lsps_scalar(&lsps[1][0], lsp_indexes, LPC_ORD);
     check_lsp_order(&lsps[1][0], LPC_ORD);
     bw_expand_lsps(&lsps[1][0], LPC_ORD);
@@ -520,12 +561,15 @@ void codec2_decode_2400(struct CODEC2 *c2, short speech[], const unsigned char *
        between, then recover spectral amplitudes */
 
     interpolate_lsp_ver2(&lsps[0][0], c2->prev_lsps_dec, &lsps[1][0], 0.5);
-    for(i=0; i<2; i++) {
+    for(i=0; i<2; i++)
 	lsp_to_lpc(&lsps[i][0], &ak[i][0], LPC_ORD);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_LSP_DECODE);
+    for(i=0; i<2; i++) {
 	aks_to_M2(c2->fft_fwd_cfg, &ak[i][0], LPC_ORD, &model[i], e[i], &snr, 0, 0, 
                   c2->lpc_pf, c2->bass_boost, c2->beta, c2->gamma); 
 	apply_lpc_correction(&model[i]);
     }
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_AKS_TO_M2);
 
     /* synthesise ------------------------------------------------*/
 
@@ -594,7 +638,7 @@ void codec2_encode_1400(struct CODEC2 *c2, unsigned char * bits, short speech[])
     pack(bits, &nbit, model.voiced, 1);
 
     /* need to run this just to get LPC energy */
-    e = speech_to_uq_lsps(lsps, ak, c2->Sn, c2->w, LPC_ORD);
+    e = speech_to_uq_lsps(lsps, ak, c2->Sn, c2->w, LPC_ORD, c2->lsp_x_enc);
 
     WoE_index = encode_WoE(&model, e, c2->xq_enc);
     pack(bits, &nbit, WoE_index, WO_E_BITS);
@@ -609,7 +653,7 @@ void codec2_encode_1400(struct CODEC2 *c2, unsigned char * bits, short speech[])
     analyse_one_frame(c2, &model, &speech[3*N]);
     pack(bits, &nbit, model.voiced, 1);
  
-    e = speech_to_uq_lsps(lsps, ak, c2->Sn, c2->w, LPC_ORD);
+    e = speech_to_uq_lsps(lsps, ak, c2->Sn, c2->w, LPC_ORD, c2->lsp_x_enc);
     WoE_index = encode_WoE(&model, e, c2->xq_enc);
     pack(bits, &nbit, WoE_index, WO_E_BITS);
  
@@ -637,13 +681,14 @@ void codec2_decode_1400(struct CODEC2 *c2, short speech[], const unsigned char *
     MODEL   model[4];
     int     lsp_indexes[LPC_ORD];
     float   lsps[4][LPC_ORD];
-    int     WoE_index;
+    int     WoE_index[2];
     float   e[4];
     float   snr;
     float   ak[4][LPC_ORD+1];
     int     i,j;
     unsigned int nbit = 0;
     float   weight;
+    PROFILE_VAR(t);
 
     assert(c2 != NULL);
 
@@ -658,21 +703,26 @@ void codec2_decode_1400(struct CODEC2 *c2, short speech[], const unsigned char *
     /* this will partially fill the model params for the 4 x 10ms
        frames */
 
+    PROFILE_SAMPLE(t);
     model[0].voiced = unpack(bits, &nbit, 1);
-    
+
     model[1].voiced = unpack(bits, &nbit, 1);
-    WoE_index = unpack(bits, &nbit, WO_E_BITS);
-    decode_WoE(&model[1], &e[1], c2->xq_dec, WoE_index);
+    WoE_index[0] = unpack(bits, &nbit, WO_E_BITS);
 
     model[2].voiced = unpack(bits, &nbit, 1);
 
     model[3].voiced = unpack(bits, &nbit, 1);
-    WoE_index = unpack(bits, &nbit, WO_E_BITS);
-    decode_WoE(&model[3], &e[3], c2->xq_dec, WoE_index);
+    WoE_index[1] = unpack(bits, &nbit, WO_E_BITS);
  
     for(i=0; i<LSP_SCALAR_INDEXES; i++) {
 	lsp_indexes[i] = unpack(bits, &nbit, lsp_bits(i));
     }
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_UNPACK);
+
+    decode_WoE(&model[1], &e[1], c2->xq_dec, WoE_index[0]);
+    decode_WoE(&model[3], &e[3], c2->xq_dec, WoE_index[1]);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_DECODE_WOE);
+
     decode_lsps_scalar(&lsps[3][0], lsp_indexes, LPC_ORD);
     check_lsp_order(&lsps[3][0], LPC_ORD);
     bw_expand_lsps(&lsps[3][0], LPC_ORD);
@@ -693,12 +743,15 @@ void codec2_decode_1400(struct CODEC2 *c2, short speech[], const unsigned char *
     for(i=0, weight=0.25; i<3; i++, weight += 0.25) {
 	interpolate_lsp_ver2(&lsps[i][0], c2->prev_lsps_dec, &lsps[3][0], weight);
     }
-    for(i=0; i<4; i++) {
+    for(i=0; i<4; i++)
 	lsp_to_lpc(&lsps[i][0], &ak[i][0], LPC_ORD);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_LSP_DECODE);
+    for(i=0; i<4; i++) {
 	aks_to_M2(c2->fft_fwd_cfg, &ak[i][0], LPC_ORD, &model[i], e[i], &snr, 0, 0,
                   c2->lpc_pf, c2->bass_boost, c2->beta, c2->gamma); 
 	apply_lpc_correction(&model[i]);
     }
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_AKS_TO_M2);
 
     /* synthesise ------------------------------------------------*/
 
@@ -771,7 +824,7 @@ void codec2_encode_1200(struct CODEC2 *c2, unsigned char * bits, short speech[])
     pack(bits, &nbit, model.voiced, 1);
 
     /* need to run this just to get LPC energy */
-    e = speech_to_uq_lsps(lsps, ak, c2->Sn, c2->w, LPC_ORD);
+    e = speech_to_uq_lsps(lsps, ak, c2->Sn, c2->w, LPC_ORD, c2->lsp_x_enc);
 
     WoE_index = encode_WoE(&model, e, c2->xq_enc);
     pack(bits, &nbit, WoE_index, WO_E_BITS);
@@ -786,7 +839,7 @@ void codec2_encode_1200(struct CODEC2 *c2, unsigned char * bits, short speech[])
     analyse_one_frame(c2, &model, &speech[3*N]);
     pack(bits, &nbit, model.voiced, 1);
  
-    e = speech_to_uq_lsps(lsps, ak, c2->Sn, c2->w, LPC_ORD);
+    e = speech_to_uq_lsps(lsps, ak, c2->Sn, c2->w, LPC_ORD, c2->lsp_x_enc);
     WoE_index = encode_WoE(&model, e, c2->xq_enc);
     pack(bits, &nbit, WoE_index, WO_E_BITS);
  
@@ -815,13 +868,14 @@ void codec2_decode_1200(struct CODEC2 *c2, short speech[], const unsigned char *
     MODEL   model[4];
     int     lsp_indexes[LPC_ORD];
     float   lsps[4][LPC_ORD];
-    int     WoE_index;
+    int     WoE_index[2];
     float   e[4];
     float   snr;
     float   ak[4][LPC_ORD+1];
     int     i,j;
     unsigned int nbit = 0;
     float   weight;
+    PROFILE_VAR(t);
 
     assert(c2 != NULL);
 
@@ -836,21 +890,26 @@ void codec2_decode_1200(struct CODEC2 *c2, short speech[], const unsigned char *
     /* this will partially fill the model params for the 4 x 10ms
        frames */
 
+    PROFILE_SAMPLE(t);
     model[0].voiced = unpack(bits, &nbit, 1);
 
     model[1].voiced = unpack(bits, &nbit, 1);
-    WoE_index = unpack(bits, &nbit, WO_E_BITS);
-    decode_WoE(&model[1], &e[1], c2->xq_dec, WoE_index);
+    WoE_index[0] = unpack(bits, &nbit, WO_E_BITS);
 
     model[2].voiced = unpack(bits, &nbit, 1);
 
     model[3].voiced = unpack(bits, &nbit, 1);
-    WoE_index = unpack(bits, &nbit, WO_E_BITS);
-    decode_WoE(&model[3], &e[3], c2->xq_dec, WoE_index);
+    WoE_index[1] = unpack(bits, &nbit, WO_E_BITS);
  
     for(i=0; i<LSP_PRED_VQ_INDEXES; i++) {
 	lsp_indexes[i] = unpack(bits, &nbit, lsp_pred_vq_bits(i));
     }
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_UNPACK);
+
+    decode_WoE(&model[1], &e[1], c2->xq_dec, WoE_index[0]);
+    decode_WoE(&model[3], &e[3], c2->xq_dec, WoE_index[1]);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_DECODE_WOE);
+
     decode_lsps_vq(lsp_indexes, &lsps[3][0], LPC_ORD);
     check_lsp_order(&lsps[3][0], LPC_ORD);
     bw_expand_lsps(&lsps[3][0], LPC_ORD);
@@ -871,12 +930,15 @@ void codec2_decode_1200(struct CODEC2 *c2, short speech[], const unsigned char *
     for(i=0, weight=0.25; i<3; i++, weight += 0.25) {
 	interpolate_lsp_ver2(&lsps[i][0], c2->prev_lsps_dec, &lsps[3][0], weight);
     }
-    for(i=0; i<4; i++) {
+    for(i=0; i<4; i++)
 	lsp_to_lpc(&lsps[i][0], &ak[i][0], LPC_ORD);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_LSP_DECODE);
+    for(i=0; i<4; i++) {
 	aks_to_M2(c2->fft_fwd_cfg, &ak[i][0], LPC_ORD, &model[i], e[i], &snr, 0, 0,
                   c2->lpc_pf, c2->bass_boost, c2->beta, c2->gamma); 
 	apply_lpc_correction(&model[i]);
     }
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_AKS_TO_M2);
 
     /* synthesise ------------------------------------------------*/
 
@@ -905,10 +967,17 @@ void codec2_decode_1200(struct CODEC2 *c2, short speech[], const unsigned char *
 void synthesise_one_frame(struct CODEC2 *c2, short speech[], MODEL *model, float ak[])
 {
     int     i;
-
-    phase_synth_zero_order(c2->fft_fwd_cfg, model, ak, &c2->ex_phase, LPC_ORD);
-    postfilter(model, &c2->bg_est);
-    synthesise(c2->fft_inv_cfg, c2->Sn_, model, c2->Pn, 1);
+    PROFILE_VAR(t);
+
+    PROFILE_SAMPLE(t);
+    phase_synth_zero_order(c2->fft_fwd_cfg, model, ak, &c2->ex_phase, LPC_ORD,
+			   &c2->prng);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_PHASE_SYNTH_ZERO_ORDER);
+    postfilter(model, &c2->bg_est, &c2->prng);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_POSTFILTER);
+    synthesise(c2->fft_inv_cfg, c2->fftr_inv_cfg, c2->synth_engine, c2->Sn_, model,
+	       c2->Pn, 1);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_SYNTHESISE);
     ear_protection(c2->Sn_, N);
 
     for(i=0; i<N; i++) {
@@ -936,8 +1005,6 @@ void synthesise_one_frame(struct CODEC2 *c2, short speech[], MODEL *model, float
 void analyse_one_frame(struct CODEC2 *c2, MODEL *model, short speech[])
 {
     COMP    Sw[FFT_ENC];
-    COMP    Sw_[FFT_ENC];
-    COMP    Ew[FFT_ENC];
     float   pitch, snr;
     int     i;
 
@@ -948,19 +1015,20 @@ void analyse_one_frame(struct CODEC2 *c2, MODEL *model, short speech[])
     for(i=0; i<N; i++)
       c2->Sn[i+M-N] = speech[i];
 
-    dft_speech(c2->fft_fwd_cfg, Sw, c2->Sn, c2->w);
+    dft_speech(c2->fftr_fwd_cfg, Sw, c2->Sn, c2->w);
 
     /* Estimate pitch */
 
-    nlp(c2->nlp,c2->Sn,N,M,P_MIN,P_MAX,&pitch,Sw, c2->W, &c2->prev_Wo_enc);
+    c2->pitch_engine->estimate(c2->pitch_state, c2->Sn, N, M, P_MIN, P_MAX, &pitch,
+			       Sw, c2->W, &c2->prev_Wo_enc);
     model->Wo = TWO_PI/pitch;
     model->L = PI/model->Wo;
 
     /* estimate model parameters */
 
     two_stage_pitch_refinement(model, Sw);
-    estimate_amplitudes(model, Sw, c2->W);
-    snr = est_voicing_mbe(model, Sw, c2->W, Sw_, Ew, c2->prev_Wo_enc);
+    estimate_amplitudes(model, Sw, c2->W, 0);
+    snr = est_voicing_mbe(model, Sw, c2->W, NULL, NULL, c2->prev_Wo_enc);
     //fprintf(stderr,"snr %3.2f  v: %d  Wo: %f prev_Wo: %f\n", 
     //	   snr, model->voiced, model->Wo, c2->prev_Wo_enc);
     c2->prev_Wo_enc = model->Wo;
@@ -1015,6 +1083,112 @@ void CODEC2_WIN32SUPPORT codec2_set_lpc_post_filter(struct CODEC2 *c2, int enabl
     c2->gamma = gamma;
 }
 
+/* pitch estimators, indexed by CODEC2_PITCH_XXX */
+
+static const struct PITCH_ENGINE pitch_engines[] = {
+    { "nlp", nlp_create, nlp_destroy, nlp },
+    { "yin", yin_create, yin_destroy, yin }
+};
+
+const struct PITCH_ENGINE *pitch_engine(int engine)
+{
+    if ((engine < 0) || (engine >= (int)(sizeof(pitch_engines)/sizeof(pitch_engines[0]))))
+	return NULL;
+
+    return &pitch_engines[engine];
+}
+
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: codec2_set_pitch_engine
+  DATE CREATED: 19 Oct 2026
+
+  Selects the encoder pitch estimator, one of CODEC2_PITCH_XXX.
+  CODEC2_PITCH_NLP is the default, CODEC2_PITCH_YIN takes a fraction
+  of the CPU at the cost of more gross pitch errors (bench_dsp pitch).
+  The new estimator starts with fresh states.  Returns 0 on success,
+  -1 if the engine is unknown or out of memory, in which case the
+  current engine is kept.
+
+\*---------------------------------------------------------------------------*/
+
+int CODEC2_WIN32SUPPORT codec2_set_pitch_engine(struct CODEC2 *c2, int engine)
+{
+    const struct PITCH_ENGINE *pe;
+    void                      *state;
+
+    assert(c2 != NULL);
+    pe = pitch_engine(engine);
+    if (pe == NULL)
+	return -1;
+    if (engine == c2->pitch_engine_id)
+	return 0;
+    state = pe->create();
+    if (state == NULL)
+	return -1;
+
+    c2->pitch_engine->destroy(c2->pitch_state);
+    c2->pitch_engine = pe;
+    c2->pitch_engine_id = engine;
+    c2->pitch_state = state;
+
+    return 0;
+}
+
+int CODEC2_WIN32SUPPORT codec2_get_pitch_engine(struct CODEC2 *c2)
+{
+    assert(c2 != NULL);
+    return c2->pitch_engine_id;
+}
+
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: codec2_set_synth_engine
+  DATE CREATED: 19 Oct 2026
+
+  Selects the decoder synthesis engine, one of CODEC2_SYNTH_XXX.  All
+  engines quantise the harmonics to the same FFT bins so the output
+  only differs by rounding error, CODEC2_SYNTH_FFT is the original
+  and slowest (bench_dsp synth).  The default is set at build time by
+  CODEC2_SYNTH_DEFAULT.  Returns 0 on success, -1 if the engine is
+  unknown, in which case the current engine is kept.
+
+\*---------------------------------------------------------------------------*/
+
+int CODEC2_WIN32SUPPORT codec2_set_synth_engine(struct CODEC2 *c2, int engine)
+{
+    assert(c2 != NULL);
+    if ((engine != CODEC2_SYNTH_FFT) && (engine != CODEC2_SYNTH_FFTR) &&
+	(engine != CODEC2_SYNTH_OSC))
+	return -1;
+    c2->synth_engine = engine;
+
+    return 0;
+}
+
+int CODEC2_WIN32SUPPORT codec2_get_synth_engine(struct CODEC2 *c2)
+{
+    assert(c2 != NULL);
+    return c2->synth_engine;
+}
+
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: codec2_set_rand_seed
+  DATE CREATED: 19 Oct 2026
+
+  Reseeds the random phases of the decoder.  Each instance has its own
+  generator and they all start from the same seed, so decoding is
+  reproducible and instances on different threads do not contend.
+
+\*---------------------------------------------------------------------------*/
+
+void CODEC2_WIN32SUPPORT codec2_set_rand_seed(struct CODEC2 *c2, unsigned int seed)
+{
+    assert(c2 != NULL);
+    prng_seed(&c2->prng, seed);
+}
+
 /* 
    Allows optional stealing of one of the voicing bits for use as a
    spare bit, only 1400 bit/s supported for now.  Experimental method
@@ -1056,4 +1230,46 @@ int CODEC2_WIN32SUPPORT codec2_rebuild_spare_bit(struct CODEC2 *c2, int unpacked
     return 0;
 }
 
+/*
+   As codec2_rebuild_spare_bit() but on the packed bits passed to
+   codec2_decode(), so the receiver needn't unpack and repack the
+   frame.  The bit numbering is as codec2_get_spare_bit_index().
+*/
+
+#define PACKED_BIT(bits, i) (((bits)[(i) >> 3] >> (7 - ((i) & 0x7))) & 0x1)
+#define PACKED_MASK(i)      (0x80 >> ((i) & 0x7))
+
+int CODEC2_WIN32SUPPORT codec2_rebuild_spare_bit_packed(struct CODEC2 *c2, unsigned char bits[])
+{
+    assert(c2 != NULL);
+
+    if (c2->mode != CODEC2_MODE_1400)
+        return -1;
+
+    /* if either adjacent frame is voiced, make this one voiced */
+
+    if (PACKED_BIT(bits, 1) || PACKED_BIT(bits, 11))
+	bits[10 >> 3] |= PACKED_MASK(10);
+    else
+	bits[10 >> 3] &= ~PACKED_MASK(10);
+
+    return 0;
+}
+
+/*
+   Returns the data bit carried in the spare bit of a packed frame, or
+   -1 if this mode has no spare bit.
+*/
+
+int CODEC2_WIN32SUPPORT codec2_get_spare_bit(struct CODEC2 *c2, const unsigned char bits[])
+{
+    int index;
+
+    index = codec2_get_spare_bit_index(c2);
+    if (index < 0)
+	return -1;
+
+    return PACKED_BIT(bits, index);
+}
+
 
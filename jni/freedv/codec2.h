@@ -51,6 +51,13 @@
 #define CODEC2_MODE_1400 2
 #define CODEC2_MODE_1200 3
 
+#define CODEC2_PITCH_NLP 0  /* non linear pitch estimator, the default */
+#define CODEC2_PITCH_YIN 1  /* YIN, lower CPU, for bulk and low power encoding */
+
+#define CODEC2_SYNTH_FFT  0 /* complex inverse FFT, the reference */
+#define CODEC2_SYNTH_FFTR 1 /* real inverse FFT */
+#define CODEC2_SYNTH_OSC  2 /* SIMD oscillator bank */
+
 struct CODEC2;
 
 struct CODEC2 * CODEC2_WIN32SUPPORT codec2_create(int mode);
@@ -61,8 +68,15 @@ int  CODEC2_WIN32SUPPORT codec2_samples_per_frame(struct CODEC2 *codec2_state);
 int  CODEC2_WIN32SUPPORT codec2_bits_per_frame(struct CODEC2 *codec2_state);
 
 void CODEC2_WIN32SUPPORT codec2_set_lpc_post_filter(struct CODEC2 *codec2_state, int enable, int bass_boost, float beta, float gamma);
+int  CODEC2_WIN32SUPPORT codec2_set_pitch_engine(struct CODEC2 *codec2_state, int engine);
+int  CODEC2_WIN32SUPPORT codec2_get_pitch_engine(struct CODEC2 *codec2_state);
+int  CODEC2_WIN32SUPPORT codec2_set_synth_engine(struct CODEC2 *codec2_state, int engine);
+int  CODEC2_WIN32SUPPORT codec2_get_synth_engine(struct CODEC2 *codec2_state);
+void CODEC2_WIN32SUPPORT codec2_set_rand_seed(struct CODEC2 *codec2_state, unsigned int seed);
 int  CODEC2_WIN32SUPPORT codec2_get_spare_bit_index(struct CODEC2 *codec2_state);
 int  CODEC2_WIN32SUPPORT codec2_rebuild_spare_bit(struct CODEC2 *codec2_state, int unpacked_bits[]);
+int  CODEC2_WIN32SUPPORT codec2_rebuild_spare_bit_packed(struct CODEC2 *codec2_state, unsigned char bits[]);
+int  CODEC2_WIN32SUPPORT codec2_get_spare_bit(struct CODEC2 *codec2_state, const unsigned char bits[]);
 
 #endif
 
@@ -93,6 +93,9 @@ void           CODEC2_WIN32SUPPORT fdmdv_destroy(struct FDMDV *fdmdv_state);
     
 void           CODEC2_WIN32SUPPORT fdmdv_mod(struct FDMDV *fdmdv_state, COMP tx_fdm[], int tx_bits[], int *sync_bit);
 void           CODEC2_WIN32SUPPORT fdmdv_demod(struct FDMDV *fdmdv_state, int rx_bits[], int *sync_bit, COMP rx_fdm[], int *nin);
+void           CODEC2_WIN32SUPPORT fdmdv_demod_packed(struct FDMDV *fdmdv_state, unsigned char rx_bits[], int nbit, int *sync_bit, COMP rx_fdm[], int *nin);
+void           CODEC2_WIN32SUPPORT fdmdv_set_fade_hold(struct FDMDV *fdmdv_state, int frames);
+void           CODEC2_WIN32SUPPORT fdmdv_end_fade_hold(struct FDMDV *fdmdv_state);
     
 void           CODEC2_WIN32SUPPORT fdmdv_get_test_bits(struct FDMDV *fdmdv_state, int tx_bits[]);
 void           CODEC2_WIN32SUPPORT fdmdv_put_test_bits(struct FDMDV *f, int *sync, int *bit_errors, int *ntest_bits, int rx_bits[]);
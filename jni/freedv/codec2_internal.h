@@ -32,18 +32,25 @@
 struct CODEC2 {
     int           mode;
     kiss_fft_cfg  fft_fwd_cfg;             /* forward FFT config                        */
+    kiss_fftr_cfg fftr_fwd_cfg;            /* forward real FFT config                   */
     float         w[M];	                   /* time domain hamming window                */
     COMP          W[FFT_ENC];	           /* DFT of w[]                                */
     float         Pn[2*N];	           /* trapezoidal synthesis window              */
     float         Sn[M];                   /* input speech                              */
     float         hpf_states[2];           /* high pass filter states                   */
-    void         *nlp;                     /* pitch predictor states                    */
+    const struct PITCH_ENGINE *pitch_engine; /* pitch estimator, see pitch.h          */
+    int           pitch_engine_id;         /* CODEC2_PITCH_XXX                          */
+    void         *pitch_state;             /* pitch estimator states                    */
 
     kiss_fft_cfg  fft_inv_cfg;             /* inverse FFT config                        */
+    kiss_fftr_cfg fftr_inv_cfg;            /* inverse real FFT config                   */
+    int           synth_engine;            /* CODEC2_SYNTH_XXX                          */
     float         Sn_[2*N];	           /* synthesised output speech                 */
     float         ex_phase;                /* excitation model phase track              */
+    struct PRNG   prng;                    /* random phases                             */
     float         bg_est;                  /* background noise estimate for post filter */
     float         prev_Wo_enc;             /* previous frame's pitch estimate           */
+    float         lsp_x_enc[LPC_ORD];      /* previous frame's LSP roots, x = cos(w)    */
     MODEL         prev_model_dec;          /* previous frame's model parameters         */
     float         prev_lsps_dec[LPC_ORD];  /* previous frame's LSPs                     */
     float         prev_e_dec;              /* previous frame's LPC energy               */
@@ -36,6 +36,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
+#include <stdint.h>
 
 #include "fdmdv_internal.h"
 #include "codec2_fdmdv.h"
@@ -45,6 +46,9 @@
 #include "kiss_fft.h"
 #include "hanning.h"
 #include "os.h"
+#include "profile.h"
+#include "kernels.h"
+#include "vmath.h"
 
 /*---------------------------------------------------------------------------*\
                                                                              
@@ -104,7 +108,7 @@ static COMP cadd(COMP a, COMP b)
 
 static float cabsolute(COMP a)
 {
-    return sqrtf(powf(a.real, 2.0) + powf(a.imag, 2.0));
+    return sqrtf(a.real*a.real + a.imag*a.imag);
 }
 
 /*---------------------------------------------------------------------------*\
@@ -132,6 +136,8 @@ struct FDMDV * CODEC2_WIN32SUPPORT fdmdv_create(void)
     f = (struct FDMDV*)malloc(sizeof(struct FDMDV));
     if (f == NULL)
 	return NULL;
+
+    kernels_init();
     
     f->current_test_bit = 0;
     for(i=0; i<NTEST_BITS; i++)
@@ -221,14 +227,26 @@ struct FDMDV * CODEC2_WIN32SUPPORT fdmdv_create(void)
 
     f->fest_state = 0;
     f->coarse_fine = COARSE;
+
+    f->hold_frames = 0;
+    f->held = 0;
+    f->holding = 0;
+    f->fine_frames = 0;
+
+    f->clock_inc = 0.0;
+    f->clock_n = 0;
+    f->clock_track = 0;
+    f->clock_npending = 0;
  
     for(c=0; c<NC+1; c++) {
 	f->sig_est[c] = 0.0;
 	f->noise_est[c] = 0.0;
     }
 
-    for(i=0; i<2*FDMDV_NSPEC; i++)
+    for(i=0; i<2*FDMDV_NSPEC; i++) {
 	f->fft_buf[i] = 0.0;
+	f->fft_window[i] = 0.5 - 0.5*cosf((float)i*2.0*PI/(2*FDMDV_NSPEC));
+    }
     f->fft_cfg = kiss_fft_alloc (2*FDMDV_NSPEC, 0, NULL, NULL);
     assert(f->fft_cfg != NULL);
 
@@ -254,6 +272,43 @@ void CODEC2_WIN32SUPPORT fdmdv_destroy(struct FDMDV *fdmdv)
     free(fdmdv);
 }
 
+/*---------------------------------------------------------------------------*\
+                                                       
+  FUNCTION....: fdmdv_set_fade_hold()	     
+  DATE CREATED: 19 Oct 2026
+
+  Sets the longest fade, in frames, the demod holds its fine
+  frequency, timing and phase states through when sync is lost, see
+  fade_hold().  0 goes straight back to coarse acquisition as
+  freq_state() always has.
+
+\*---------------------------------------------------------------------------*/
+
+void CODEC2_WIN32SUPPORT fdmdv_set_fade_hold(struct FDMDV *fdmdv, int frames)
+{
+    fdmdv->hold_frames = frames > 0 ? frames : 0;
+}
+
+/*---------------------------------------------------------------------------*                                                       
+  FUNCTION....: fdmdv_end_fade_hold()	     
+  DATE CREATED: 19 Oct 2026
+
+  Ends any fade hold in progress and drops back to COARSE, so the next
+  frame starts a full acquisition from the coarse frequency estimate
+  rather than the held one.  For a caller that has stopped running the
+  demod for a while.
+
+\*---------------------------------------------------------------------------*/
+
+void CODEC2_WIN32SUPPORT fdmdv_end_fade_hold(struct FDMDV *fdmdv)
+{
+    fdmdv->holding = 0;
+    fdmdv->held = 0;
+    fdmdv->fine_frames = 0;
+    fdmdv->fest_state = 0;
+    fdmdv->coarse_fine = COARSE;
+}
+
 /*---------------------------------------------------------------------------*\
                                                        
   FUNCTION....: fdmdv_get_test_bits()	     
@@ -719,14 +774,9 @@ float rx_est_freq_offset(struct FDMDV *f, COMP rx_fdm[], int nin)
 void CODEC2_WIN32SUPPORT fdmdv_freq_shift(COMP rx_fdm_fcorr[], COMP rx_fdm[], float foff, 
                                           COMP *foff_rect, COMP *foff_phase_rect, int nin)
 {
-    int   i;
-
     foff_rect->real = cosf(2.0*PI*foff/FS);
     foff_rect->imag = sinf(2.0*PI*foff/FS);
-    for(i=0; i<nin; i++) {
-	*foff_phase_rect = cmult(*foff_phase_rect, *foff_rect);
-	rx_fdm_fcorr[i] = cmult(rx_fdm[i], *foff_phase_rect);
-    }
+    kernels->cmix(rx_fdm_fcorr, rx_fdm, foff_phase_rect, *foff_rect, nin);
 
     /* normalise digital oscilator as the magnitude can drfift over time */
 
@@ -746,34 +796,21 @@ void CODEC2_WIN32SUPPORT fdmdv_freq_shift(COMP rx_fdm_fcorr[], COMP rx_fdm[], fl
 
 void fdm_downconvert(COMP rx_baseband[NC+1][M+M/P], COMP rx_fdm[], COMP phase_rx[], COMP freq[], int nin)
 {
-    int  i,c;
+    int  c;
+    COMP phase_conj;
 
     /* maximum number of input samples to demod */
 
     assert(nin <= (M+M/P));
 
-    /* Nc/2 tones below centre freq */
+    /* Nc/2 tones below centre freq, Nc/2 tones above, then the centre
+       pilot tone.  Mixing with conj(phase_rx[c]) is the same as
+       running the oscillator on the conjugates. */
   
-    for (c=0; c<NC/2; c++) 
-	for (i=0; i<nin; i++) {
-	    phase_rx[c] = cmult(phase_rx[c], freq[c]);
-	    rx_baseband[c][i] = cmult(rx_fdm[i], cconj(phase_rx[c]));
-	}
-
-    /* Nc/2 tones above centre freq */
-
-    for (c=NC/2; c<NC; c++) 
-	for (i=0; i<nin; i++) {
-	    phase_rx[c] = cmult(phase_rx[c], freq[c]);
-	    rx_baseband[c][i] = cmult(rx_fdm[i], cconj(phase_rx[c]));
-	}
-
-    /* centre pilot tone  */
-
-    c = NC;
-    for (i=0; i<nin; i++) {
-	phase_rx[c] = cmult(phase_rx[c],  freq[c]);
-	rx_baseband[c][i] = cmult(rx_fdm[i], cconj(phase_rx[c]));
+    for (c=0; c<NC+1; c++) {
+	phase_conj = cconj(phase_rx[c]);
+	kernels->cmix(rx_baseband[c], rx_fdm, &phase_conj, cconj(freq[c]), nin);
+	phase_rx[c] = cconj(phase_conj);
     }
 
     /* normalise digital oscilators as the magnitude can drfift over time */
@@ -819,11 +856,8 @@ void rx_filter(COMP rx_filt[NC+1][P+1], COMP rx_baseband[NC+1][M+M/P], COMP rx_f
 	
 	/* convolution (filtering) */
 
-	for(c=0; c<NC+1; c++) {
-	    rx_filt[c][j].real = 0.0; rx_filt[c][j].imag = 0.0;
-	    for(k=0; k<NFILTER; k++) 
-		rx_filt[c][j] = cadd(rx_filt[c][j], fcmult(gt_alpha5_root[k], rx_filter_memory[c][k]));
-	}
+	for(c=0; c<NC+1; c++)
+	    rx_filt[c][j] = kernels->cdot_real(rx_filter_memory[c], gt_alpha5_root, NFILTER);
 
 	/* make room for next input sample */
 	
@@ -952,11 +986,42 @@ float rx_est_timing(COMP rx_symbols[],
 
 float qpsk_to_bits(int rx_bits[], int *sync_bit, COMP phase_difference[], COMP prev_rx_symbols[], COMP rx_symbols[])
 {
-    int   c;
-    COMP  pi_on_4;
-    COMP  d;
-    int   msb=0, lsb=0;
-    float ferr;
+    uint32_t word;
+    float    ferr;
+    int      i;
+
+    ferr = qpsk_to_word(&word, sync_bit, phase_difference, prev_rx_symbols, rx_symbols);
+    for(i=0; i<NC*NB; i++)
+	rx_bits[i] = (word >> (NC*NB-1-i)) & 0x1;
+
+    return ferr;
+}
+
+/*---------------------------------------------------------------------------*\
+                                                       
+  FUNCTION....: qpsk_to_word()	     
+  DATE CREATED: 19 Oct 2026
+
+  As qpsk_to_bits() but returns the NC*NB bits in the low bits of
+  *word, the first bit in the most significant position.  Each
+  carrier's dibit is a function of the signs of the rotated phase
+  difference:
+
+    real imag  msb lsb
+     +    +     0   0
+     -    +     0   1
+     -    -     1   0
+     +    -     1   1
+
+\*---------------------------------------------------------------------------*/
+
+float qpsk_to_word(uint32_t *word, int *sync_bit, COMP phase_difference[], COMP prev_rx_symbols[], COMP rx_symbols[])
+{
+    int      c;
+    COMP     pi_on_4;
+    COMP     d;
+    uint32_t msb, lsb, w;
+    float    ferr;
 
     pi_on_4.real = cosf(PI/4.0);
     pi_on_4.imag = sinf(PI/4.0);
@@ -967,25 +1032,16 @@ float qpsk_to_bits(int rx_bits[], int *sync_bit, COMP phase_difference[], COMP p
     for(c=0; c<NC; c++)
 	phase_difference[c] = cmult(cmult(rx_symbols[c], cconj(prev_rx_symbols[c])), pi_on_4);
 				    
-    /* map (Nc,1) DQPSK symbols back into an (1,Nc*Nb) array of bits */
+    /* map (Nc,1) DQPSK symbols back into Nc*Nb bits */
 
+    w = 0;
     for (c=0; c<NC; c++) {
       d = phase_difference[c];
-      if ((d.real >= 0) && (d.imag >= 0)) {
-         msb = 0; lsb = 0;
-      }
-      if ((d.real < 0) && (d.imag >= 0)) {
-         msb = 0; lsb = 1;
-      }
-      if ((d.real < 0) && (d.imag < 0)) {
-         msb = 1; lsb = 0;
-      }
-      if ((d.real >= 0) && (d.imag < 0)) {
-         msb = 1; lsb = 1;
-      }
-      rx_bits[2*c] = msb;
-      rx_bits[2*c+1] = lsb;
+      msb = d.imag < 0;
+      lsb = (d.real < 0) ^ msb;
+      w = (w << 2) | (msb << 1) | lsb;
     }
+    *word = w;
  
     /* Extract DBPSK encoded Sync bit and fine freq offset estimate */
 
@@ -1008,6 +1064,63 @@ float qpsk_to_bits(int rx_bits[], int *sync_bit, COMP phase_difference[], COMP p
     return ferr;
 }
  
+/*---------------------------------------------------------------------------*\
+                                                       
+  FUNCTION....: clock_offset_update()
+  DATE CREATED: 19 Oct 2026
+
+  Updates the estimate of the tx/rx sample clock offset.  Over one
+  frame the symbol timing moves by the nin - M samples we skipped or
+  repeated plus the change in rx_timing, together this is how far the
+  symbol period measured with our clock differs from M.  Averaged over
+  CLOCK_EST_FRAMES this gives the clock offset to a few ppm, while
+  nin on its own only moves in steps of M/P.
+
+  Only frames in FINE sync are used, the timing estimate is noise
+  otherwise, and only once the timing estimate has had NT frames in
+  FINE to settle.  A fade can take a few frames to break FINE sync,
+  and random sync bits in one can look like a short lock, so each
+  frame's increment is only averaged once FINE has lasted
+  RELOCK_CONFIRM more frames, and dropped if it doesn't.
+
+\*---------------------------------------------------------------------------*/
+
+void clock_offset_update(struct FDMDV *f, float prev_rx_timing, int nin)
+{
+    float inc, oldest;
+
+    if (f->coarse_fine == COARSE || f->fine_frames <= NT) {
+	f->clock_track = 0;
+	f->clock_npending = 0;
+	return;
+    }
+    if (!f->clock_track) {
+	/* prev_rx_timing came from an unsynced frame */
+	f->clock_track = 1;
+	return;
+    }
+
+    /* rx_timing can wrap by M, and single frames with a timing jump
+       this big are outliers anyway */
+
+    inc = nin - M + f->rx_timing - prev_rx_timing;
+    if (fabsf(inc) > M/P)
+	return;
+
+    if (f->clock_npending < RELOCK_CONFIRM) {
+	f->clock_pending[f->clock_npending++] = inc;
+	return;
+    }
+    oldest = f->clock_pending[0];
+    memmove(&f->clock_pending[0], &f->clock_pending[1], sizeof(float)*(RELOCK_CONFIRM-1));
+    f->clock_pending[RELOCK_CONFIRM-1] = inc;
+    inc = oldest;
+
+    if (f->clock_n < CLOCK_EST_FRAMES)
+	f->clock_n++;
+    f->clock_inc += (inc - f->clock_inc)/f->clock_n;
+}
+
 /*---------------------------------------------------------------------------*\
                                                        
   FUNCTION....: snr_update()	     
@@ -1192,26 +1305,68 @@ int freq_state(int sync_bit, int *state)
 
 /*---------------------------------------------------------------------------*\
                                                        
-  FUNCTION....: fdmdv_demod()	     
-  AUTHOR......: David Rowe			      
-  DATE CREATED: 26/4/2012
+  FUNCTION....: fade_hold()	     
+  DATE CREATED: 19 Oct 2026
+
+  Fade hold on top of freq_state().  On HF sync is mostly lost to
+  short fades, after which the fine frequency, timing and phase states
+  are still good.  So rather than going back to the coarse estimate
+  when FINE sync is lost, the demod holds: the frequency is frozen,
+  nin stays at M, and the sync bits only need to run from
+  RELOCK_STATE, 4 of them rather than the 6 of a full acquisition,
+  to get back to FINE.  Those sync bits also have to be clean, the
+  pilot phase change within 30 degrees of 0 or pi, which noise alone
+  manages a third of the time.  COARSE is reported while holding so
+  the output stays muted.
+
+  A hold ends in full acquisition once hold_frames frames have gone by
+  without RELOCK_CONFIRM frames of FINE sync in a row, so random sync
+  bits in a fade can't keep it going for ever.  Returns the
+  coarse_fine state for the frame.
 
-  FDMDV demodulator, take an array of FDMDV_SAMPLES_PER_FRAME
-  modulated samples, returns an array of FDMDV_BITS_PER_FRAME bits,
-  plus the sync bit.  
+\*---------------------------------------------------------------------------*/
 
-  The input signal is complex to support single sided frequcny shifting
-  before the demod input (e.g. fdmdv2 click to tune feature).
+static int fade_hold(struct FDMDV *f, int coarse_fine, int sync_bit, int clean)
+{
+    if (f->holding && !clean) {
+	f->fest_state = 0;
+	coarse_fine = COARSE;
+    }
 
-  The number of input samples nin will normally be M ==
-  FDMDV_SAMPLES_PER_FRAME.  However to adjust for differences in
-  transmit and receive sample clocks nin will occasionally be M-M/P,
-  or M+M/P.
+    if (coarse_fine == FINE) {
+	f->holding = 0;
+	if (++f->fine_frames >= RELOCK_CONFIRM)
+	    f->held = 0;
+	return FINE;
+    }
 
-\*---------------------------------------------------------------------------*/
+    /* just lost sync, held still counts the frames of a hold we
+       re-locked from too briefly */
 
-void CODEC2_WIN32SUPPORT fdmdv_demod(struct FDMDV *fdmdv, int rx_bits[], 
-				     int *sync_bit, COMP rx_fdm[], int *nin)
+    if (f->coarse_fine == FINE)
+	f->holding = f->hold_frames > 0;
+    f->fine_frames = 0;
+    if (!f->holding)
+	return COARSE;
+
+    if (++f->held > f->hold_frames) {
+	f->holding = 0;
+	f->held = 0;
+	f->fest_state = 0;
+	return COARSE;
+    }
+
+    /* carry on from RELOCK_STATE, even states wait for a 0 */
+
+    if (f->fest_state < RELOCK_STATE)
+	f->fest_state = sync_bit ? RELOCK_STATE : RELOCK_STATE + 1;
+    return COARSE;
+}
+
+/* the demodulator proper, the bits come out as from qpsk_to_word() */
+
+static void demod_word(struct FDMDV *fdmdv, uint32_t *word, int *sync_bit, COMP rx_fdm[],
+		       int *nin)
 {
     float         foff_coarse, foff_fine;
     COMP          rx_fdm_fcorr[M+M/P];
@@ -1219,39 +1374,123 @@ void CODEC2_WIN32SUPPORT fdmdv_demod(struct FDMDV *fdmdv, int rx_bits[],
     COMP          rx_filt[NC+1][P+1];
     COMP          rx_symbols[NC+1];
     float         env[NT*P];
+    float         prev_rx_timing = fdmdv->rx_timing;
+    int           nin_used = *nin;
+    COMP          pilot;
+    int           clean;
+    PROFILE_VAR(t);
  
     /* freq offset estimation and correction */
    
+    PROFILE_SAMPLE(t);
     foff_coarse = rx_est_freq_offset(fdmdv, rx_fdm, *nin);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_RX_EST_FREQ_OFFSET);
     
-    if (fdmdv->coarse_fine == COARSE)
+    if (fdmdv->coarse_fine == COARSE && !fdmdv->holding)
 	fdmdv->foff = foff_coarse;
     fdmdv_freq_shift(rx_fdm_fcorr, rx_fdm, -fdmdv->foff, &fdmdv->foff_rect, &fdmdv->foff_phase_rect, *nin);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_FDMDV_FREQ_SHIFT);
 	
     /* baseband processing */
 
     fdm_downconvert(rx_baseband, rx_fdm_fcorr, fdmdv->phase_rx, fdmdv->freq, *nin);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_FDM_DOWNCONVERT);
     rx_filter(rx_filt, rx_baseband, fdmdv->rx_filter_memory, *nin);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_RX_FILTER);
     fdmdv->rx_timing = rx_est_timing(rx_symbols, rx_filt, rx_baseband, fdmdv->rx_filter_mem_timing, env, fdmdv->rx_baseband_mem_timing, *nin);	 
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_RX_EST_TIMING);
     
-    /* Adjust number of input samples to keep timing within bounds */
+    /* Adjust number of input samples to keep timing within bounds,
+       a held demod keeps the timing it had */
 
     *nin = M;
 
-    if (fdmdv->rx_timing > 2*M/P)
+    if (fdmdv->rx_timing > 2*M/P && !fdmdv->holding)
 	*nin += M/P;
     
-    if (fdmdv->rx_timing < 0)
+    if (fdmdv->rx_timing < 0 && !fdmdv->holding)
 	*nin -= M/P;
     
-    foff_fine = qpsk_to_bits(rx_bits, sync_bit, fdmdv->phase_difference, fdmdv->prev_rx_symbols, rx_symbols);
+    PROFILE_SAMPLE(t);
+    foff_fine = qpsk_to_word(word, sync_bit, fdmdv->phase_difference, fdmdv->prev_rx_symbols, rx_symbols);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_QPSK_TO_BITS);
+    pilot = cmult(rx_symbols[NC], cconj(fdmdv->prev_rx_symbols[NC]));
+    clean = fabsf(pilot.imag) < RELOCK_TAN*fabsf(pilot.real);
     memcpy(fdmdv->prev_rx_symbols, rx_symbols, sizeof(COMP)*(NC+1));
     snr_update(fdmdv->sig_est, fdmdv->noise_est, fdmdv->phase_difference);
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_SNR_UPDATE);
 
     /* freq offset estimation state machine */
 
-    fdmdv->coarse_fine = freq_state(*sync_bit, &fdmdv->fest_state);
-    fdmdv->foff  -= TRACK_COEFF*foff_fine;
+    fdmdv->coarse_fine = fade_hold(fdmdv, freq_state(*sync_bit, &fdmdv->fest_state),
+					*sync_bit, clean);
+    if (!fdmdv->holding)
+	fdmdv->foff  -= TRACK_COEFF*foff_fine;
+
+    clock_offset_update(fdmdv, prev_rx_timing, nin_used);
+}
+
+/*---------------------------------------------------------------------------*\
+                                                       
+  FUNCTION....: fdmdv_demod()	     
+  AUTHOR......: David Rowe			      
+  DATE CREATED: 26/4/2012
+
+  FDMDV demodulator, take an array of FDMDV_SAMPLES_PER_FRAME
+  modulated samples, returns an array of FDMDV_BITS_PER_FRAME bits,
+  plus the sync bit.  
+
+  The input signal is complex to support single sided frequcny shifting
+  before the demod input (e.g. fdmdv2 click to tune feature).
+
+  The number of input samples nin will normally be M ==
+  FDMDV_SAMPLES_PER_FRAME.  However to adjust for differences in
+  transmit and receive sample clocks nin will occasionally be M-M/P,
+  or M+M/P.
+
+\*---------------------------------------------------------------------------*/
+
+void CODEC2_WIN32SUPPORT fdmdv_demod(struct FDMDV *fdmdv, int rx_bits[], 
+				     int *sync_bit, COMP rx_fdm[], int *nin)
+{
+    uint32_t word;
+    int      i;
+
+    demod_word(fdmdv, &word, sync_bit, rx_fdm, nin);
+    for(i=0; i<NC*NB; i++)
+	rx_bits[i] = (word >> (NC*NB-1-i)) & 0x1;
+}
+
+/*---------------------------------------------------------------------------*\
+                                                       
+  FUNCTION....: fdmdv_demod_packed()	     
+  DATE CREATED: 19 Oct 2026
+
+  As fdmdv_demod() but writes the FDMDV_BITS_PER_FRAME bits straight
+  into the packed byte array rx_bits[], most significant bit first as
+  codec2_encode() packs them, starting at bit nbit.  The other bits
+  of rx_bits[] are left alone, so two consecutive frames can be
+  demodulated into one codec frame by passing nbit = 0 then nbit =
+  FDMDV_BITS_PER_FRAME.
+
+\*---------------------------------------------------------------------------*/
+
+void CODEC2_WIN32SUPPORT fdmdv_demod_packed(struct FDMDV *fdmdv, unsigned char rx_bits[],
+					    int nbit, int *sync_bit, COMP rx_fdm[], int *nin)
+{
+    uint32_t      word;
+    int           nbits, byte, space, n;
+    unsigned char mask;
+
+    demod_word(fdmdv, &word, sync_bit, rx_fdm, nin);
+
+    for(nbits=NC*NB; nbits>0; nbits-=n, nbit+=n) {
+	byte  = nbit >> 3;
+	space = 8 - (nbit & 0x7);
+	n     = (nbits < space) ? nbits : space;
+	mask  = ((1 << n) - 1) << (space - n);
+	rx_bits[byte] = (rx_bits[byte] & ~mask) | (((word >> (nbits - n)) << (space - n)) & mask);
+    }
 }
 
 /*---------------------------------------------------------------------------*\
@@ -1269,12 +1508,12 @@ float calc_snr(float sig_est[], float noise_est[])
     float S, SdB;
     float mean, N50, N50dB, N3000dB;
     float snr_dB;
+    float p[2], p_dB[2];
     int   c;
    
     S = 0.0;
     for(c=0; c<NC+1; c++)
-	S += powf(sig_est[c], 2.0);
-    SdB = 10.0*log10f(S+1E-12);
+	S += sig_est[c]*sig_est[c];
     
     /* Average noise mag across all carriers and square to get an
        average noise power.  This is an estimate of the noise power in
@@ -1285,8 +1524,12 @@ float calc_snr(float sig_est[], float noise_est[])
     for(c=0; c<NC+1; c++)
 	mean += noise_est[c];
     mean /= (NC+1);
-    N50 = powf(mean, 2.0);
-    N50dB = 10.0*log10f(N50+1E-12);
+    N50 = mean*mean;
+
+    p[0] = S+1E-12; p[1] = N50+1E-12;
+    vlog10f(p_dB, p, 2);
+    SdB = 10.0*p_dB[0];
+    N50dB = 10.0*p_dB[1];
 
     /* Now multiply by (3000 Hz)/(50 Hz) to find the total noise power
        in 3000 Hz */
@@ -1317,7 +1560,10 @@ void CODEC2_WIN32SUPPORT fdmdv_get_demod_stats(struct FDMDV *fdmdv,
     fdmdv_stats->fest_coarse_fine = fdmdv->coarse_fine;
     fdmdv_stats->foff = fdmdv->foff;
     fdmdv_stats->rx_timing = fdmdv->rx_timing;
-    fdmdv_stats->clock_offset = 0.0; /* TODO - implement clock offset estimation */
+
+    /* a symbol period longer than M of our samples means the tx clock is slow */
+
+    fdmdv_stats->clock_offset = -1E6*fdmdv->clock_inc/M;
 
     assert((NC+1) == FDMDV_NSYM);
 
@@ -1395,13 +1641,13 @@ void CODEC2_WIN32SUPPORT fdmdv_8_to_48(float out48k[], float in8k[], int n)
 
 void CODEC2_WIN32SUPPORT fdmdv_48_to_8(float out8k[], float in48k[], int n)
 {
-    int i,j;
+    int i;
 
-    for(i=0; i<n; i++) {
-	out8k[i] = 0.0;
-	for(j=0; j<FDMDV_OS_TAPS; j++)
-	    out8k[i] += fdmdv_os_filter[j]*in48k[i*FDMDV_OS-j];
-    }
+    /* fdmdv_os_filter[] is symmetric, so we can run forwards through
+       the input rather than backwards */
+
+    for(i=0; i<n; i++)
+	out8k[i] = kernels->dot(&in48k[i*FDMDV_OS-FDMDV_OS_TAPS+1], fdmdv_os_filter, FDMDV_OS_TAPS);
 
     /* update filter memory */
 
@@ -1445,6 +1691,10 @@ void CODEC2_WIN32SUPPORT fdmdv_get_rx_spectrum(struct FDMDV *f, float mag_spec_d
     COMP  fft_in[2*FDMDV_NSPEC];
     COMP  fft_out[2*FDMDV_NSPEC];
     float full_scale_dB;
+    float pw[FDMDV_NSPEC];
+    PROFILE_VAR(t);
+
+    PROFILE_SAMPLE(t);
 
     /* update buffer of input samples */
 
@@ -1457,7 +1707,7 @@ void CODEC2_WIN32SUPPORT fdmdv_get_rx_spectrum(struct FDMDV *f, float mag_spec_d
     /* window and FFT */
 
     for(i=0; i<2*FDMDV_NSPEC; i++) {
-	fft_in[i].real = f->fft_buf[i] * (0.5 - 0.5*cosf((float)i*2.0*PI/(2*FDMDV_NSPEC)));
+	fft_in[i].real = f->fft_buf[i] * f->fft_window[i];
 	fft_in[i].imag = 0.0;
     }
 
@@ -1469,10 +1719,15 @@ void CODEC2_WIN32SUPPORT fdmdv_get_rx_spectrum(struct FDMDV *f, float mag_spec_d
 
     /* scale and convert to dB */
 
+    for(i=0; i<FDMDV_NSPEC; i++)
+	pw[i] = fft_out[i].real*fft_out[i].real + fft_out[i].imag*fft_out[i].imag + 1E-12;
+    vlog10f(mag_spec_dB, pw, FDMDV_NSPEC);
     for(i=0; i<FDMDV_NSPEC; i++) {
-	mag_spec_dB[i]  = 10.0*log10f(fft_out[i].real*fft_out[i].real + fft_out[i].imag*fft_out[i].imag + 1E-12);
+	mag_spec_dB[i]  = 10.0*mag_spec_dB[i];
 	mag_spec_dB[i] -= full_scale_dB;
     }
+
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_FDMDV_GET_RX_SPECTRUM);
 }
 
 /*---------------------------------------------------------------------------*\
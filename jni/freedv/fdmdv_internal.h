@@ -29,6 +29,8 @@
 #ifndef __FDMDV_INTERNAL__
 #define __FDMDV_INTERNAL__
 
+#include <stdint.h>
+
 #include "comp.h"
 #include "codec2_fdmdv.h"
 #include "kiss_fft.h"
@@ -68,10 +70,14 @@
 
 #define COARSE                   0
 #define FINE                     1
+#define RELOCK_STATE             2  /* freq_state() state a held demod re-locks from, 4 sync bits short of FINE */
+#define RELOCK_CONFIRM          10  /* frames of FINE sync that end a fade hold                               */
+#define RELOCK_TAN            0.58  /* tan of the furthest a re-locking pilot symbol may be off the real axis */
 
 /* averaging filter coeffs */
 
 #define TRACK_COEFF              0.5
+#define CLOCK_EST_FRAMES       500  /* averaging time of the clock offset estimate, in frames               */
 #define SNR_COEFF                0.9       /* SNR est averaging filter coeff */
 
 /*---------------------------------------------------------------------------*\
@@ -131,6 +137,21 @@ struct FDMDV {
     int  fest_state;
     int  coarse_fine;
 
+    /* fade hold states */
+
+    int  hold_frames;                       /* longest fade held through, 0 for none        */
+    int  held;                              /* frames without FINE sync in this hold        */
+    int  holding;                           /* in a hold, fine states kept                  */
+    int  fine_frames;                       /* frames of FINE sync since the last re-lock   */
+
+    /* sample clock offset estimation states */
+
+    float clock_inc;                        /* mean symbol period - M, in samples */
+    int   clock_n;                          /* frames averaged so far             */
+    int   clock_track;                      /* previous frame was in FINE sync    */
+    float clock_pending[RELOCK_CONFIRM];    /* latest increments, not yet averaged */
+    int   clock_npending;
+
     /* SNR estimation states */
 
     float sig_est[NC+1];
@@ -139,6 +160,7 @@ struct FDMDV {
     /* Buf for FFT/waterfall */
 
     float fft_buf[2*FDMDV_NSPEC];
+    float fft_window[2*FDMDV_NSPEC];
     kiss_fft_cfg fft_cfg;             
  };
 
@@ -166,7 +188,9 @@ float rx_est_timing(COMP  rx_symbols[],
 		   COMP  rx_baseband_mem_timing[NC+1][NFILTERTIMING], 
 		   int   nin);	 
 float qpsk_to_bits(int rx_bits[], int *sync_bit, COMP phase_difference[], COMP prev_rx_symbols[], COMP rx_symbols[]);
+float qpsk_to_word(uint32_t *word, int *sync_bit, COMP phase_difference[], COMP prev_rx_symbols[], COMP rx_symbols[]);
 void snr_update(float sig_est[], float noise_est[], COMP phase_difference[]);
+void clock_offset_update(struct FDMDV *f, float prev_rx_timing, int nin);
 int freq_state(int sync_bit, int *state);
 float calc_snr(float sig_est[], float noise_est[]);
 
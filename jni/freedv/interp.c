@@ -34,8 +34,9 @@
 #include "interp.h"
 #include "lsp.h"
 #include "quantise.h"
+#include "vmath.h"
 
-float sample_log_amp(MODEL *model, float w);
+float sample_log_amp(MODEL *model, const float log_A[], float w);
 
 /*---------------------------------------------------------------------------*\
 
@@ -66,7 +67,9 @@ void interpolate(
 )
 {
     int   l;
-    float w,log_amp;
+    float w;
+    float log_prev[MAX_AMP+1], log_next[MAX_AMP+1];
+    float log_amp[MAX_AMP+1];
 
     /* Wo depends on voicing of this and adjacent frames */
 
@@ -85,11 +88,19 @@ void interpolate(
 
     /* Interpolate amplitudes using linear interpolation in log domain */
 
+    for(l=1; l<=prev->L; l++)
+	log_prev[l] = prev->A[l] + 1E-6;
+    vlog10f(&log_prev[1], &log_prev[1], prev->L);
+    for(l=1; l<=next->L; l++)
+	log_next[l] = next->A[l] + 1E-6;
+    vlog10f(&log_next[1], &log_next[1], next->L);
+
     for(l=1; l<=interp->L; l++) {
 	w = l*interp->Wo;
-	log_amp = (sample_log_amp(prev, w) + sample_log_amp(next, w))/2.0;
-	interp->A[l] = powf(10.0, log_amp);
+	log_amp[l] = (sample_log_amp(prev, log_prev, w) +
+		      sample_log_amp(next, log_next, w))/2.0;
     }
+    vexp10f(&interp->A[1], &log_amp[1], interp->L);
 }
 
 /*---------------------------------------------------------------------------*\
@@ -100,11 +111,11 @@ void interpolate(
         
   Samples the amplitude envelope at an arbitrary frequency w.  Uses
   linear interpolation in the log domain to sample between harmonic
-  amplitudes.
+  amplitudes.  log_A[m] is log10(model->A[m] + 1E-6).
   
 \*---------------------------------------------------------------------------*/
 
-float sample_log_amp(MODEL *model, float w)
+float sample_log_amp(MODEL *model, const float log_A[], float w)
 {
     int   m;
     float f, log_amp;
@@ -116,14 +127,13 @@ float sample_log_amp(MODEL *model, float w)
     assert(f <= 1.0);
 
     if (m < 1) {
-	log_amp = f*log10f(model->A[1] + 1E-6);
+	log_amp = f*log_A[1];
     }
     else if ((m+1) > model->L) {
-	log_amp = (1.0-f)*log10f(model->A[model->L] + 1E-6);
+	log_amp = (1.0-f)*log_A[model->L];
     }
     else {
-	log_amp = (1.0-f)*log10f(model->A[m] + 1E-6) + 
-                  f*log10f(model->A[m+1] + 1E-6);
+	log_amp = (1.0-f)*log_A[m] + f*log_A[m+1];
     }
 
     return log_amp;
@@ -193,9 +203,10 @@ void interpolate_lsp(
 	lsps_interp[i] = (prev_lsps[i] + next_lsps[i])/2.0;
     }
 
-    /* Interpolate LPC energy in log domain */
+    /* Interpolate LPC energy in log domain, the mean of the logs is
+       the log of the geometric mean */
 
-    e = powf(10.0, (log10f(prev_e) + log10f(next_e))/2.0);
+    e = sqrtf(prev_e*next_e);
     //printf("  interp: e: %f\n", e);
 
     /* convert back to amplitudes */
@@ -260,8 +271,9 @@ void interp_Wo(
 
 float interp_energy(float prev_e, float next_e)
 {
-    return powf(10.0, (log10f(prev_e) + log10f(next_e))/2.0);
- 
+    /* 10^((log10(prev_e) + log10(next_e))/2), the geometric mean */
+
+    return sqrtf(prev_e*next_e);
 }
 
 
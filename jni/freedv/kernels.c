@@ -0,0 +1,453 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: kernels.c
+  DATE CREATED: 19 Oct 2026
+
+  Scalar DSP kernels and the run time selection of the SIMD versions,
+  see kernels.h.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "kernels.h"
+
+#if defined(__ANDROID__) && defined(__arm__)
+#include <cpu-features.h>
+#elif defined(__linux__) && defined(__arm__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
+/*---------------------------------------------------------------------------*\
+
+                               SCALAR KERNELS
+
+\*---------------------------------------------------------------------------*/
+
+static float dot_scalar(const float x[], const float h[], int n)
+{
+    float acc = 0.0;
+    int   i;
+
+    for(i=0; i<n; i++)
+	acc += x[i]*h[i];
+
+    return acc;
+}
+
+static COMP cdot_real_scalar(const COMP x[], const float h[], int n)
+{
+    COMP acc;
+    int  i;
+
+    acc.real = 0.0; acc.imag = 0.0;
+    for(i=0; i<n; i++) {
+	acc.real += h[i]*x[i].real;
+	acc.imag += h[i]*x[i].imag;
+    }
+
+    return acc;
+}
+
+static void cmix_scalar(COMP y[], const COMP x[], COMP *phase, COMP freq, int n)
+{
+    COMP  ph = *phase;
+    float re;
+    int   i;
+
+    for(i=0; i<n; i++) {
+	re = ph.real*freq.real - ph.imag*freq.imag;
+	ph.imag = ph.real*freq.imag + ph.imag*freq.real;
+	ph.real = re;
+	y[i].real = x[i].real*ph.real - x[i].imag*ph.imag;
+	y[i].imag = x[i].real*ph.imag + x[i].imag*ph.real;
+    }
+
+    *phase = ph;
+}
+
+static int vq_search_scalar(const float cb[], int entries, int ndim,
+			    const float x[], const float w[], float *dist)
+{
+    float d, e, beste;
+    int   i, j, besti;
+
+    besti = 0;
+    beste = 1E32;
+    for(i=0; i<entries; i++, cb += ndim) {
+	e = 0.0;
+	if (w != NULL) {
+	    for(j=0; j<ndim; j++) {
+		d = x[j] - cb[j];
+		e += w[j]*d*d;
+	    }
+	}
+	else {
+	    for(j=0; j<ndim; j++) {
+		d = x[j] - cb[j];
+		e += d*d;
+	    }
+	}
+	if (e < beste) {
+	    beste = e;
+	    besti = i;
+	}
+    }
+
+    if (dist != NULL)
+	*dist = beste;
+
+    return besti;
+}
+
+static void bfly4_scalar(COMP Fout[], const COMP tw[], int fstride, int m, int inverse)
+{
+    const COMP *tw1, *tw2, *tw3;
+    COMP        s0, s1, s2, s3, s4, s5;
+    int         k;
+
+    tw1 = tw2 = tw3 = tw;
+    for(k=0; k<m; k++, Fout++) {
+	s0.real = Fout[m].real*tw1->real - Fout[m].imag*tw1->imag;
+	s0.imag = Fout[m].real*tw1->imag + Fout[m].imag*tw1->real;
+	s1.real = Fout[2*m].real*tw2->real - Fout[2*m].imag*tw2->imag;
+	s1.imag = Fout[2*m].real*tw2->imag + Fout[2*m].imag*tw2->real;
+	s2.real = Fout[3*m].real*tw3->real - Fout[3*m].imag*tw3->imag;
+	s2.imag = Fout[3*m].real*tw3->imag + Fout[3*m].imag*tw3->real;
+
+	s5.real = Fout->real - s1.real; s5.imag = Fout->imag - s1.imag;
+	Fout->real += s1.real; Fout->imag += s1.imag;
+	s3.real = s0.real + s2.real; s3.imag = s0.imag + s2.imag;
+	s4.real = s0.real - s2.real; s4.imag = s0.imag - s2.imag;
+	Fout[2*m].real = Fout->real - s3.real;
+	Fout[2*m].imag = Fout->imag - s3.imag;
+	tw1 += fstride;
+	tw2 += fstride*2;
+	tw3 += fstride*3;
+	Fout->real += s3.real; Fout->imag += s3.imag;
+
+	if (inverse) {
+	    Fout[m].real   = s5.real - s4.imag;
+	    Fout[m].imag   = s5.imag + s4.real;
+	    Fout[3*m].real = s5.real + s4.imag;
+	    Fout[3*m].imag = s5.imag - s4.real;
+	}
+	else {
+	    Fout[m].real   = s5.real + s4.imag;
+	    Fout[m].imag   = s5.imag - s4.real;
+	    Fout[3*m].real = s5.real - s4.imag;
+	    Fout[3*m].imag = s5.imag + s4.real;
+	}
+    }
+}
+
+static void harm_sum_scalar(const float Pw[], const float k[], int ncand, int L,
+			    float E[])
+{
+    float e, mk;
+    int   c, m;
+
+    for(c=0; c<ncand; c++) {
+	e = 0.0;
+	for(m=1; m<=L; m++) {
+	    mk = m*k[c];
+	    e += Pw[(int)(mk + 0.5f)];
+	}
+	E[c] = e;
+    }
+}
+
+static void osc_bank_scalar(float y[], float re[], float im[], const float cr[],
+			    const float ci[], int nosc, int n)
+{
+    float r, q, t;
+    int   i, l;
+
+    for(i=0; i<n; i++)
+	y[i] = 0.0;
+    for(l=0; l<nosc; l++) {
+	r = re[l]; q = im[l];
+	for(i=0; i<n; i++) {
+	    y[i] += r;
+	    t = r*cr[l] - q*ci[l];
+	    q = r*ci[l] + q*cr[l];
+	    r = t;
+	}
+	re[l] = r; im[l] = q;
+    }
+}
+
+static void autocorr_scalar(float R[], const float x[], const float w[], int n,
+			    int nlags)
+{
+    float s[512];
+    float r;
+    int   i, j;
+
+    assert(n <= 512);
+    for(i=0; i<n; i++)
+	s[i] = w ? x[i]*w[i] : x[i];
+
+    for(j=0; j<nlags; j++) {
+	r = 0.0;
+	for(i=0; i<n-j; i++)
+	    r += s[i]*s[i+j];
+	R[j] = r;
+    }
+}
+
+static void colour_map_scalar(uint32_t y[], const float x[], int n, float lo,
+			      float scale, const uint32_t lut[256])
+{
+    float v;
+    int   i;
+
+    for(i=0; i<n; i++) {
+	v = (x[i] - lo)*scale;
+	if (v < 0.0f)   v = 0.0f;
+	if (v > 255.0f) v = 255.0f;
+	y[i] = lut[(int)v];
+    }
+}
+
+const struct KERNELS kernels_scalar = {
+    "scalar",
+    dot_scalar,
+    cdot_real_scalar,
+    cmix_scalar,
+    vq_search_scalar,
+    bfly4_scalar,
+    harm_sum_scalar,
+    osc_bank_scalar,
+    autocorr_scalar,
+    colour_map_scalar
+};
+
+/*---------------------------------------------------------------------------*\
+
+                              KERNEL SELECTION
+
+\*---------------------------------------------------------------------------*/
+
+/* levels in order of preference, lowest first */
+
+static const struct KERNELS *levels[] = {
+    &kernels_scalar,
+#ifdef KERNELS_HAVE_NEON
+    &kernels_neon,
+#endif
+#ifdef KERNELS_HAVE_SSE2
+    &kernels_sse2,
+#endif
+#ifdef KERNELS_HAVE_AVX2
+    &kernels_avx2,
+#endif
+};
+
+#define NUM_LEVELS (int)(sizeof(levels)/sizeof(levels[0]))
+
+static struct KERNELS  active;
+const struct KERNELS  *kernels = &kernels_scalar;
+static int             initialised;
+
+/* does this CPU run the instructions used by levels[l] */
+
+static int cpu_supports(int l)
+{
+    const struct KERNELS *k = levels[l];
+
+    if (k == &kernels_scalar)
+	return 1;
+
+#ifdef KERNELS_HAVE_NEON
+    if (k == &kernels_neon) {
+#if defined(__aarch64__)
+	return 1;
+#elif defined(__ANDROID__)
+	return (android_getCpuFamily() == ANDROID_CPU_FAMILY_ARM) &&
+	       (android_getCpuFeatures() & ANDROID_CPU_ARM_FEATURE_NEON);
+#elif defined(__linux__)
+	return (getauxval(AT_HWCAP) & HWCAP_NEON) != 0;
+#else
+	return 0;
+#endif
+    }
+#endif
+
+#ifdef KERNELS_HAVE_SSE2
+    if (k == &kernels_sse2)
+	return __builtin_cpu_supports("sse2");
+#endif
+#ifdef KERNELS_HAVE_AVX2
+    if (k == &kernels_avx2)
+	return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+
+    return 0;
+}
+
+static int find_level(const char *name)
+{
+    int l;
+
+    for(l=0; l<NUM_LEVELS; l++)
+	if (strcmp(levels[l]->name, name) == 0)
+	    return l;
+
+    return -1;
+}
+
+static int best_level(void)
+{
+    int l;
+
+    for(l=NUM_LEVELS-1; l>0; l--)
+	if (cpu_supports(l))
+	    break;
+
+    return l;
+}
+
+/* build a table from levels[0..top], each level overriding the
+   kernels it implements */
+
+static void build_level(int top, struct KERNELS *k)
+{
+    int l;
+
+    *k = kernels_scalar;
+    for(l=1; l<=top; l++) {
+	if (!cpu_supports(l))
+	    continue;
+	k->name = levels[l]->name;
+	if (levels[l]->dot)       k->dot       = levels[l]->dot;
+	if (levels[l]->cdot_real) k->cdot_real = levels[l]->cdot_real;
+	if (levels[l]->cmix)      k->cmix      = levels[l]->cmix;
+	if (levels[l]->vq_search) k->vq_search = levels[l]->vq_search;
+	if (levels[l]->bfly4)     k->bfly4     = levels[l]->bfly4;
+	if (levels[l]->harm_sum)  k->harm_sum  = levels[l]->harm_sum;
+	if (levels[l]->osc_bank)  k->osc_bank  = levels[l]->osc_bank;
+	if (levels[l]->autocorr)  k->autocorr  = levels[l]->autocorr;
+	if (levels[l]->colour_map) k->colour_map = levels[l]->colour_map;
+    }
+}
+
+static void use_level(int top)
+{
+    struct KERNELS k;
+
+    build_level(top, &k);
+    active = k;
+    kernels = &active;
+}
+
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: kernels_init()
+  DATE CREATED: 19 Oct 2026
+
+  Selects the best kernels for this CPU, or the level named by the
+  FREEDV_KERNELS environment variable if set and supported.  Safe to
+  call more than once, only the first call does anything.  Called from
+  the codec2, fdmdv and nlp create functions.
+
+\*---------------------------------------------------------------------------*/
+
+void CODEC2_WIN32SUPPORT kernels_init(void)
+{
+    const char *env;
+
+    if (initialised)
+	return;
+    initialised = 1;
+
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_cpu_init();
+#endif
+
+    env = getenv("FREEDV_KERNELS");
+    if ((env != NULL) && (kernels_select(env) == 0))
+	return;
+
+    use_level(best_level());
+}
+
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: kernels_select()
+  DATE CREATED: 19 Oct 2026
+
+  Forces the kernel level, e.g. "scalar" or "neon".  Returns 0 on
+  success, -1 if the level is unknown or not supported by this CPU,
+  in which case the current selection is kept.  Intended for tests,
+  don't call while another thread is running the modem or codec.
+
+  "check" runs the best level for this CPU and the scalar reference
+  side by side, see kernels_check.c.
+
+\*---------------------------------------------------------------------------*/
+
+int CODEC2_WIN32SUPPORT kernels_select(const char *name)
+{
+    int l;
+
+    assert(name != NULL);
+
+    if (!initialised) {
+	initialised = 1;
+#if defined(__i386__) || defined(__x86_64__)
+	__builtin_cpu_init();
+#endif
+    }
+
+    if (strcmp(name, "check") == 0) {
+	struct KERNELS k;
+
+	build_level(best_level(), &k);
+	active = k;
+	kernels = kernels_check_wrap(&active);
+	return 0;
+    }
+
+    l = find_level(name);
+    if ((l < 0) || !cpu_supports(l))
+	return -1;
+
+    use_level(l);
+    return 0;
+}
+
+int CODEC2_WIN32SUPPORT kernels_supported(const char *name)
+{
+    int l;
+
+    kernels_init();
+    if (strcmp(name, "check") == 0)
+	return 1;
+    l = find_level(name);
+
+    return (l >= 0) && cpu_supports(l);
+}
+
+const char * CODEC2_WIN32SUPPORT kernels_name(void)
+{
+    return kernels->name;
+}
@@ -0,0 +1,157 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: kernels.h
+  DATE CREATED: 19 Oct 2026
+
+  Run time dispatch of the hot DSP inner loops.
+
+  Each kernel has a plain C version in kernels.c and may have NEON
+  (kernels_neon.c), SSE2 (kernels_sse2.c) and AVX2 (kernels_avx2.c)
+  versions.  kernels_init() picks the best level the CPU supports, a
+  level that does not provide a kernel inherits it from the level
+  below, so a SIMD file only needs to implement the kernels that
+  benefit.
+
+  Callers go through the kernels pointer, which is valid (scalar)
+  even before kernels_init() has run:
+
+    y = kernels->dot(x, h, n);
+
+  The level can be forced for testing with kernels_select() or the
+  FREEDV_KERNELS environment variable, e.g. FREEDV_KERNELS=scalar.
+
+  FREEDV_KERNELS=check runs every kernel twice, the best level for
+  this CPU and the scalar reference, compares the outputs against a
+  per kernel tolerance and logs the first divergence of each kernel.
+  The optimised result is the one used, so the receiver behaves as it
+  would in production.  Fast paths that are not in the table can join
+  in through kernels_checking() and kernels_check_float().
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __KERNELS__
+#define __KERNELS__
+
+#include <stdint.h>
+
+#include "comp.h"
+#include "codec2_fdmdv.h"        /* CODEC2_WIN32SUPPORT */
+
+#if defined(__arm__) || defined(__aarch64__)
+#define KERNELS_HAVE_NEON
+#endif
+#if defined(__i386__) || defined(__x86_64__)
+#define KERNELS_HAVE_SSE2
+#define KERNELS_HAVE_AVX2
+#endif
+
+struct KERNELS {
+    const char *name;
+
+    /* sum of x[i]*h[i], i=0..n-1 */
+
+    float (*dot)(const float x[], const float h[], int n);
+
+    /* sum of h[i]*x[i] for complex x[] and real h[] */
+
+    COMP  (*cdot_real)(const COMP x[], const float h[], int n);
+
+    /* complex mixer: for each sample *phase *= freq, y[i] = x[i]*(*phase) */
+
+    void  (*cmix)(COMP y[], const COMP x[], COMP *phase, COMP freq, int n);
+
+    /* index of the codebook entry nearest x[], using the distance
+       sum of w[j]*(x[j]-cb[j])^2 (w[] may be NULL for unweighted).
+       Ties go to the lowest index.  The distance is returned in *dist
+       if dist is not NULL. */
+
+    int   (*vq_search)(const float cb[], int entries, int ndim,
+		       const float x[], const float w[], float *dist);
+
+    /* kiss_fft radix 4 butterfly, tw[] is the twiddle table of the
+       whole FFT */
+
+    void  (*bfly4)(COMP Fout[], const COMP tw[], int fstride, int m,
+		   int inverse);
+
+    /* harmonic sums for ncand candidate fundamentals of k[c] bins:
+       E[c] = sum of Pw[(int)(m*k[c] + 0.5)], m=1..L.  Vector versions
+       evaluate several candidates at once, one per lane. */
+
+    void  (*harm_sum)(const float Pw[], const float k[], int ncand, int L,
+		      float E[]);
+
+    /* oscillator bank: for i=0..n-1, y[i] is the sum of re[l] over the
+       nosc phasors (re[l],im[l]), then each phasor is multiplied by
+       (cr[l],ci[l]).  The phasors are updated in place, nosc <= 128. */
+
+    void  (*osc_bank)(float y[], float re[], float im[], const float cr[],
+		      const float ci[], int nosc, int n);
+
+    /* autocorrelation of the windowed signal xw[i] = x[i]*w[i], or of
+       x[] itself if w is NULL: R[j] = sum of xw[i]*xw[i+j] over
+       i=0..n-1-j, for lags j=0..nlags-1.  n <= 512, nlags <= 32. */
+
+    void  (*autocorr)(float R[], const float x[], const float w[], int n,
+		      int nlags);
+
+    /* colour map, e.g. spectrum dB to pixels: y[i] = lut[q] where q is
+       (x[i] - lo)*scale clamped to 0..255 and truncated. */
+
+    void  (*colour_map)(uint32_t y[], const float x[], int n, float lo,
+			float scale, const uint32_t lut[256]);
+};
+
+extern const struct KERNELS *kernels;
+
+void CODEC2_WIN32SUPPORT kernels_init(void);
+int  CODEC2_WIN32SUPPORT kernels_select(const char *name);
+int  CODEC2_WIN32SUPPORT kernels_supported(const char *name);
+const char * CODEC2_WIN32SUPPORT kernels_name(void);
+
+/* check mode, see kernels_check.c */
+
+struct KERNELS_CHECK_STATS {
+    const char   *name;          /* kernel                              */
+    unsigned long calls;         /* compared since last reset           */
+    unsigned long failures;      /* calls outside tolerance             */
+    float         max_err;       /* largest relative error seen         */
+};
+
+int  CODEC2_WIN32SUPPORT kernels_checking(void);
+int  CODEC2_WIN32SUPPORT kernels_check_float(const char *name, const float ref[],
+					     const float opt[], int n, float tol);
+int  CODEC2_WIN32SUPPORT kernels_check_stats(int i, struct KERNELS_CHECK_STATS *stats);
+void CODEC2_WIN32SUPPORT kernels_check_reset(void);
+
+const struct KERNELS *kernels_check_wrap(const struct KERNELS *opt);
+
+/* per level tables, entries left NULL are inherited from the level below */
+
+extern const struct KERNELS kernels_scalar;
+#ifdef KERNELS_HAVE_NEON
+extern const struct KERNELS kernels_neon;
+#endif
+#ifdef KERNELS_HAVE_SSE2
+extern const struct KERNELS kernels_sse2;
+#endif
+#ifdef KERNELS_HAVE_AVX2
+extern const struct KERNELS kernels_avx2;
+#endif
+
+#endif
@@ -0,0 +1,308 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: kernels_avx2.c
+  DATE CREATED: 19 Oct 2026
+
+  AVX2/FMA versions of the long filter kernels, the gather based
+  harmonic sum, the oscillator bank and the autocorrelation, see
+  kernels.h.  The VQ search and FFT butterfly are
+  too short or too strided to gain from the wider registers and are
+  inherited from kernels_sse2.c.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <assert.h>
+
+#include "kernels.h"
+
+#ifdef KERNELS_HAVE_AVX2
+
+#include <immintrin.h>
+
+/* only these functions use AVX2, the rest of the library is built
+   for the baseline ISA */
+
+#define AVX2 __attribute__((target("avx2,fma")))
+
+AVX2 static inline float hsum8(__m256 v)
+{
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1,1,1,1)));
+    return _mm_cvtss_f32(s);
+}
+
+/* four complex multiplies, a*b */
+
+AVX2 static inline __m256 cmul4(__m256 a, __m256 b)
+{
+    __m256 b_re = _mm256_moveldup_ps(b);
+    __m256 b_im = _mm256_movehdup_ps(b);
+    __m256 a_sw = _mm256_permute_ps(a, _MM_SHUFFLE(2,3,0,1));
+
+    return _mm256_fmaddsub_ps(a, b_re, _mm256_mul_ps(a_sw, b_im));
+}
+
+AVX2 static float dot_avx2(const float x[], const float h[], int n)
+{
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    float  acc;
+    int    i;
+
+    for(i=0; i+16<=n; i+=16) {
+	acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i]),   _mm256_loadu_ps(&h[i]),   acc0);
+	acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i+8]), _mm256_loadu_ps(&h[i+8]), acc1);
+    }
+    if (i+8 <= n) {
+	acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i]), _mm256_loadu_ps(&h[i]), acc0);
+	i += 8;
+    }
+    acc = hsum8(_mm256_add_ps(acc0, acc1));
+    for(; i<n; i++)
+	acc += x[i]*h[i];
+
+    return acc;
+}
+
+AVX2 static COMP cdot_real_avx2(const COMP x[], const float h[], int n)
+{
+    const __m256i lo = _mm256_setr_epi32(0,0,1,1,2,2,3,3);
+    const __m256i hi = _mm256_setr_epi32(4,4,5,5,6,6,7,7);
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    __m256 h8;
+    __m128 s;
+    COMP   acc;
+    int    i;
+
+    for(i=0; i+8<=n; i+=8) {
+	h8 = _mm256_loadu_ps(&h[i]);
+	acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i].real),
+			       _mm256_permutevar8x32_ps(h8, lo), acc0);
+	acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i+4].real),
+			       _mm256_permutevar8x32_ps(h8, hi), acc1);
+    }
+    acc0 = _mm256_add_ps(acc0, acc1);
+    s = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    acc.real = _mm_cvtss_f32(s);
+    acc.imag = _mm_cvtss_f32(_mm_shuffle_ps(s, s, _MM_SHUFFLE(1,1,1,1)));
+    for(; i<n; i++) {
+	acc.real += h[i]*x[i].real;
+	acc.imag += h[i]*x[i].imag;
+    }
+
+    return acc;
+}
+
+/* four oscillator phases per register, advanced by freq^4 */
+
+AVX2 static void cmix_avx2(COMP y[], const COMP x[], COMP *phase, COMP freq, int n)
+{
+    COMP   ph = *phase, ph4[4], f4;
+    __m256 p, last, step;
+    float  re;
+    int    i;
+
+    if (n >= 4) {
+	for(i=0; i<4; i++) {
+	    re = ph.real*freq.real - ph.imag*freq.imag;
+	    ph.imag = ph.real*freq.imag + ph.imag*freq.real;
+	    ph.real = re;
+	    ph4[i] = ph;
+	}
+	re = freq.real*freq.real - freq.imag*freq.imag;
+	f4.imag = 2.0*freq.real*freq.imag;
+	f4.real = re*re - f4.imag*f4.imag;
+	f4.imag = 2.0*re*f4.imag;
+
+	p = last = _mm256_loadu_ps(&ph4[0].real);
+	step = _mm256_setr_ps(f4.real, f4.imag, f4.real, f4.imag,
+			      f4.real, f4.imag, f4.real, f4.imag);
+	for(i=0; i+4<=n; i+=4) {
+	    _mm256_storeu_ps(&y[i].real, cmul4(_mm256_loadu_ps(&x[i].real), p));
+	    last = p;
+	    p = cmul4(p, step);
+	}
+	_mm256_storeu_ps(&ph4[0].real, last);
+	ph = ph4[3];
+    }
+    else
+	i = 0;
+
+    for(; i<n; i++) {
+	re = ph.real*freq.real - ph.imag*freq.imag;
+	ph.imag = ph.real*freq.imag + ph.imag*freq.real;
+	ph.real = re;
+	y[i].real = x[i].real*ph.real - x[i].imag*ph.imag;
+	y[i].imag = x[i].real*ph.imag + x[i].imag*ph.real;
+    }
+
+    *phase = ph;
+}
+
+/* eight candidates per register with the AVX2 gather.  Built without
+   FMA so m*k + 0.5 is rounded twice, as in the scalar version, and
+   the bins match. */
+
+__attribute__((target("avx2")))
+static void harm_sum_avx2(const float Pw[], const float k[], int ncand, int L,
+			  float E[])
+{
+    float  kk[8], e[8];
+    __m256 k8, mf, acc;
+    int    c, m, i;
+
+    for(c=0; c<ncand; c+=8) {
+	for(i=0; i<8; i++)
+	    kk[i] = (c+i < ncand) ? k[c+i] : 0.0;
+	k8  = _mm256_loadu_ps(kk);
+	mf  = _mm256_setzero_ps();
+	acc = _mm256_setzero_ps();
+	for(m=1; m<=L; m++) {
+	    mf = _mm256_add_ps(mf, _mm256_set1_ps(1.0));
+	    acc = _mm256_add_ps(acc, _mm256_i32gather_ps(Pw,
+		      _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(mf, k8),
+							_mm256_set1_ps(0.5))), 4));
+	}
+	_mm256_storeu_ps(e, acc);
+	for(i=0; (i<8) && (c+i<ncand); i++)
+	    E[c+i] = e[i];
+    }
+}
+
+/* eight oscillators per register, as kernels_sse2.c */
+
+AVX2 static void osc_bank_avx2(float y[], float re[], float im[], const float cr[],
+			       const float ci[], int nosc, int n)
+{
+    __m256 r[128/8], q[128/8], c[128/8], s[128/8];
+    __m256 acc, t;
+    float  b[4][8];
+    int    i, g, ng, j, l;
+
+    assert(nosc <= 128);
+    ng = (nosc + 7)/8;
+
+    /* a short last group is padded with zero phasors */
+
+    for(g=0; g<ng; g++) {
+	for(j=0; j<8; j++) {
+	    l = g*8 + j;
+	    b[0][j] = (l < nosc) ? re[l] : 0.0;
+	    b[1][j] = (l < nosc) ? im[l] : 0.0;
+	    b[2][j] = (l < nosc) ? cr[l] : 1.0;
+	    b[3][j] = (l < nosc) ? ci[l] : 0.0;
+	}
+	r[g] = _mm256_loadu_ps(b[0]); q[g] = _mm256_loadu_ps(b[1]);
+	c[g] = _mm256_loadu_ps(b[2]); s[g] = _mm256_loadu_ps(b[3]);
+    }
+
+    for(i=0; i<n; i++) {
+	acc = _mm256_setzero_ps();
+	for(g=0; g<ng; g++) {
+	    acc  = _mm256_add_ps(acc, r[g]);
+	    t    = _mm256_fmsub_ps(r[g], c[g], _mm256_mul_ps(q[g], s[g]));
+	    q[g] = _mm256_fmadd_ps(r[g], s[g], _mm256_mul_ps(q[g], c[g]));
+	    r[g] = t;
+	}
+	y[i] = hsum8(acc);
+    }
+
+    for(g=0; g<ng; g++) {
+	_mm256_storeu_ps(b[0], r[g]); _mm256_storeu_ps(b[1], q[g]);
+	for(j=0; j<8; j++) {
+	    l = g*8 + j;
+	    if (l < nosc) {
+		re[l] = b[0][j];
+		im[l] = b[1][j];
+	    }
+	}
+    }
+}
+
+/* eight lags at a time, one per accumulator, as kernels_sse2.c */
+
+AVX2 static void autocorr_avx2(float R[], const float x[], const float w[], int n,
+			       int nlags)
+{
+    float  s[512 + 40];
+    __m256 a, acc[8];
+    int    i, j, k;
+
+    assert((n <= 512) && (nlags <= 32));
+    for(i=0; i<n; i++)
+	s[i] = w ? x[i]*w[i] : x[i];
+    for(; i<n+40; i++)
+	s[i] = 0.0;
+
+    for(j=0; j<nlags; j+=8) {
+	for(k=0; k<8; k++)
+	    acc[k] = _mm256_setzero_ps();
+	for(i=0; i<n; i+=8) {
+	    a = _mm256_loadu_ps(&s[i]);
+	    for(k=0; k<8; k++)
+		acc[k] = _mm256_fmadd_ps(a, _mm256_loadu_ps(&s[i+j+k]), acc[k]);
+	}
+	for(k=0; (k<8) && (j+k<nlags); k++)
+	    R[j+k] = hsum8(acc[k]);
+    }
+}
+
+/* eight pixels at a time, the LUT is read with a gather */
+
+AVX2 static void colour_map_avx2(uint32_t y[], const float x[], int n, float lo,
+				 float scale, const uint32_t lut[256])
+{
+    __m256  vlo = _mm256_set1_ps(lo), vscale = _mm256_set1_ps(scale);
+    __m256  zero = _mm256_setzero_ps(), top = _mm256_set1_ps(255.0f);
+    __m256  v;
+    __m128  s;
+    int     i;
+
+    for(i=0; i+8<=n; i+=8) {
+	v = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(&x[i]), vlo), vscale);
+	v = _mm256_min_ps(_mm256_max_ps(v, zero), top);
+	_mm256_storeu_si256((__m256i *)&y[i],
+			    _mm256_i32gather_epi32((const int *)lut,
+						   _mm256_cvttps_epi32(v), 4));
+    }
+    for(; i<n; i++) {
+	s = _mm_mul_ss(_mm_sub_ss(_mm_load_ss(&x[i]), _mm256_castps256_ps128(vlo)),
+		       _mm256_castps256_ps128(vscale));
+	s = _mm_min_ss(_mm_max_ss(s, _mm_setzero_ps()), _mm_set_ss(255.0f));
+	y[i] = lut[_mm_cvttss_si32(s)];
+    }
+}
+
+const struct KERNELS kernels_avx2 = {
+    "avx2",
+    dot_avx2,
+    cdot_real_avx2,
+    cmix_avx2,
+    NULL,
+    NULL,
+    harm_sum_avx2,
+    osc_bank_avx2,
+    autocorr_avx2,
+    colour_map_avx2
+};
+
+#endif
@@ -0,0 +1,459 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: kernels_check.c
+  DATE CREATED: 19 Oct 2026
+
+  Check mode for the DSP kernels: each kernel call runs the scalar
+  reference and the optimised version on the same live data and
+  compares them, see kernels.h.
+
+  Errors are measured relative to a scale that suits each kernel,
+  e.g. the sum of |x[i]*h[i]| for a dot product, so the tolerances
+  below are in units of single precision rounding rather than signal
+  level.  The first divergence of each kernel is logged with its
+  context, after that only the counters are updated.
+
+  This is a debugging aid, it more than doubles the CPU load and the
+  counters are not thread safe.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "kernels.h"
+
+#ifdef __ANDROID__
+#include <android/log.h>
+#define CHECK_LOG(...) __android_log_print(ANDROID_LOG_WARN, "libfreedv", __VA_ARGS__)
+#else
+#define CHECK_LOG(...) fprintf(stderr, __VA_ARGS__)
+#endif
+
+#define MAX_CHECKS  32          /* kernels we keep counters for         */
+#define MAX_N       1024        /* longest complex vector we can check  */
+#define TINY        1E-20
+
+/* per kernel tolerances, relative to the scale of each kernel */
+
+#define TOL_DOT       1E-5
+#define TOL_CDOT_REAL 1E-5
+#define TOL_CMIX      1E-4      /* oscillator error grows with n        */
+#define TOL_VQ_SEARCH 1E-5      /* only used when the indexes differ    */
+#define TOL_BFLY4     1E-5
+#define TOL_HARM_SUM  1E-5      /* a different bin is a gross error     */
+#define TOL_OSC_BANK  1E-4      /* as cmix, phasor error grows with n   */
+#define TOL_AUTOCORR  1E-5
+#define TOL_COLOUR_MAP 0.01     /* fraction of pixels a colour out      */
+
+struct CHECK {
+    const char   *name;
+    unsigned long calls;
+    unsigned long failures;
+    float         max_err;
+};
+
+static struct CHECK checks[MAX_CHECKS];
+static int          nchecks;
+
+static const struct KERNELS *opt;     /* the kernels under test */
+
+static struct CHECK *find_check(const char *name)
+{
+    int i;
+
+    for(i=0; i<nchecks; i++)
+	if ((checks[i].name == name) || (strcmp(checks[i].name, name) == 0))
+	    return &checks[i];
+
+    assert(nchecks < MAX_CHECKS);
+    checks[nchecks].name = name;
+    return &checks[nchecks++];
+}
+
+/*
+  Records one call.  err is the worst relative error of the call, at
+  element index of n, with ref and res the values there.  ctx
+  describes the call for the log.  Returns 0 if within tolerance.
+*/
+
+static int check_result(const char *name, float tol, float err, int index, int n,
+			float ref, float res, const char *ctx)
+{
+    struct CHECK *c = find_check(name);
+
+    c->calls++;
+    if (err > c->max_err)
+	c->max_err = err;
+    if (err <= tol)
+	return 0;
+
+    if (c->failures++ == 0)
+	CHECK_LOG("kernels check: %s (%s) diverged from scalar on call %lu, "
+		  "element %d of %d: ref %g opt %g, rel err %g > %g%s%s\n",
+		  name, opt ? opt->name : "-", c->calls, index, n, ref, res,
+		  err, tol, ctx ? ", " : "", ctx ? ctx : "");
+    return -1;
+}
+
+/* worst element of two float vectors, relative to scale */
+
+static float worst(const float ref[], const float res[], int n, float scale, int *index)
+{
+    float err, max_err;
+    int   i;
+
+    if (scale < TINY)
+	scale = TINY;
+    max_err = 0.0;
+    *index = 0;
+    for(i=0; i<n; i++) {
+	err = fabsf(ref[i] - res[i])/scale;
+	if (err > max_err) {
+	    max_err = err;
+	    *index = i;
+	}
+    }
+
+    return max_err;
+}
+
+/*---------------------------------------------------------------------------*\
+
+                                 WRAPPERS
+
+\*---------------------------------------------------------------------------*/
+
+static float dot_check(const float x[], const float h[], int n)
+{
+    float ref, res, scale;
+    char  ctx[32];
+    int   i;
+
+    ref = kernels_scalar.dot(x, h, n);
+    res = opt->dot(x, h, n);
+
+    scale = TINY;
+    for(i=0; i<n; i++)
+	scale += fabsf(x[i]*h[i]);
+    snprintf(ctx, sizeof(ctx), "n=%d", n);
+    check_result("dot", TOL_DOT, fabsf(ref - res)/scale, 0, 1, ref, res, ctx);
+
+    return res;
+}
+
+static COMP cdot_real_check(const COMP x[], const float h[], int n)
+{
+    COMP  ref, res;
+    float scale, err_re, err_im;
+    char  ctx[32];
+    int   i;
+
+    ref = kernels_scalar.cdot_real(x, h, n);
+    res = opt->cdot_real(x, h, n);
+
+    scale = TINY;
+    for(i=0; i<n; i++)
+	scale += fabsf(h[i])*(fabsf(x[i].real) + fabsf(x[i].imag));
+    err_re = fabsf(ref.real - res.real)/scale;
+    err_im = fabsf(ref.imag - res.imag)/scale;
+    snprintf(ctx, sizeof(ctx), "n=%d", n);
+    if (err_re >= err_im)
+	check_result("cdot_real", TOL_CDOT_REAL, err_re, 0, 2, ref.real, res.real, ctx);
+    else
+	check_result("cdot_real", TOL_CDOT_REAL, err_im, 1, 2, ref.imag, res.imag, ctx);
+
+    return res;
+}
+
+/* the outputs and the final oscillator phase are compared, the
+   phase is stored after the outputs as element n */
+
+static void cmix_check(COMP y[], const COMP x[], COMP *phase, COMP freq, int n)
+{
+    COMP  ref[MAX_N+1], res[MAX_N+1];
+    COMP  ph_ref = *phase;
+    float scale, err;
+    char  ctx[64];
+    int   i, index;
+
+    assert(n <= MAX_N);
+    kernels_scalar.cmix(ref, x, &ph_ref, freq, n);
+    opt->cmix(y, x, phase, freq, n);
+
+    memcpy(res, y, sizeof(COMP)*n);
+    ref[n] = ph_ref;
+    res[n] = *phase;
+
+    scale = 1.0;                   /* |phase|, and |y| <= |x| */
+    for(i=0; i<n; i++) {
+	scale = fmaxf(scale, fabsf(x[i].real));
+	scale = fmaxf(scale, fabsf(x[i].imag));
+    }
+    err = worst(&ref[0].real, &res[0].real, 2*(n+1), scale, &index);
+    snprintf(ctx, sizeof(ctx), "n=%d freq (%g,%g)", n, freq.real, freq.imag);
+    check_result("cmix", TOL_CMIX, err, index, 2*(n+1),
+		 (&ref[0].real)[index], (&res[0].real)[index], ctx);
+}
+
+/* different indexes are fine as long as the distances are equal to
+   within rounding, e.g. two identical codebook entries */
+
+static int vq_search_check(const float cb[], int entries, int ndim,
+			   const float x[], const float w[], float *dist)
+{
+    float d_ref, d_res, d;
+    int   i_ref, i_res;
+    char  ctx[64];
+
+    i_ref = kernels_scalar.vq_search(cb, entries, ndim, x, w, &d_ref);
+    i_res = opt->vq_search(cb, entries, ndim, x, w, &d_res);
+
+    snprintf(ctx, sizeof(ctx), "entries=%d ndim=%d index ref %d opt %d",
+	     entries, ndim, i_ref, i_res);
+    if (i_ref == i_res)
+	check_result("vq_search", TOL_VQ_SEARCH, 0.0, i_res, entries, d_ref, d_res, ctx);
+    else {
+	kernels_scalar.vq_search(&cb[i_res*ndim], 1, ndim, x, w, &d);
+	check_result("vq_search", TOL_VQ_SEARCH, fabsf(d - d_ref)/(fabsf(d_ref) + TINY),
+		     i_res, entries, d_ref, d, ctx);
+    }
+
+    if (dist != NULL)
+	*dist = d_res;
+
+    return i_res;
+}
+
+static void bfly4_check(COMP Fout[], const COMP tw[], int fstride, int m, int inverse)
+{
+    COMP  ref[MAX_N];
+    float scale, err;
+    char  ctx[64];
+    int   i, index;
+
+    assert(4*m <= MAX_N);
+    memcpy(ref, Fout, sizeof(COMP)*4*m);
+
+    scale = TINY;
+    for(i=0; i<4*m; i++)
+	scale = fmaxf(scale, fabsf(ref[i].real) + fabsf(ref[i].imag));
+    scale *= 4.0;
+
+    kernels_scalar.bfly4(ref, tw, fstride, m, inverse);
+    opt->bfly4(Fout, tw, fstride, m, inverse);
+
+    err = worst(&ref[0].real, &Fout[0].real, 8*m, scale, &index);
+    snprintf(ctx, sizeof(ctx), "m=%d fstride=%d inverse=%d", m, fstride, inverse);
+    check_result("bfly4", TOL_BFLY4, err, index, 8*m,
+		 (&ref[0].real)[index], (&Fout[0].real)[index], ctx);
+}
+
+static void harm_sum_check(const float Pw[], const float k[], int ncand, int L,
+			   float E[])
+{
+    float ref[MAX_N];
+    float scale, err;
+    char  ctx[32];
+    int   i, index;
+
+    assert(ncand <= MAX_N);
+    kernels_scalar.harm_sum(Pw, k, ncand, L, ref);
+    opt->harm_sum(Pw, k, ncand, L, E);
+
+    scale = TINY;
+    for(i=0; i<ncand; i++)
+	scale = fmaxf(scale, fabsf(ref[i]));
+    err = worst(ref, E, ncand, scale, &index);
+    snprintf(ctx, sizeof(ctx), "ncand=%d L=%d", ncand, L);
+    check_result("harm_sum", TOL_HARM_SUM, err, index, ncand, ref[index], E[index], ctx);
+}
+
+static void osc_bank_check(float y[], float re[], float im[], const float cr[],
+			   const float ci[], int nosc, int n)
+{
+    float ref[MAX_N], ref_re[MAX_N], ref_im[MAX_N];
+    float scale, err;
+    char  ctx[32];
+    int   i, index;
+
+    assert((n <= MAX_N) && (nosc <= MAX_N));
+    memcpy(ref_re, re, sizeof(float)*nosc);
+    memcpy(ref_im, im, sizeof(float)*nosc);
+
+    /* y[] can reach the sum of the amplitudes */
+
+    scale = TINY;
+    for(i=0; i<nosc; i++)
+	scale += sqrtf(re[i]*re[i] + im[i]*im[i]);
+
+    kernels_scalar.osc_bank(ref, ref_re, ref_im, cr, ci, nosc, n);
+    opt->osc_bank(y, re, im, cr, ci, nosc, n);
+
+    err = worst(ref, y, n, scale, &index);
+    snprintf(ctx, sizeof(ctx), "nosc=%d n=%d", nosc, n);
+    check_result("osc_bank", TOL_OSC_BANK, err, index, n, ref[index], y[index], ctx);
+}
+
+static void autocorr_check(float R[], const float x[], const float w[], int n,
+			   int nlags)
+{
+    float ref[MAX_N];
+    float err;
+    char  ctx[32];
+    int   index;
+
+    assert(nlags <= MAX_N);
+    kernels_scalar.autocorr(ref, x, w, n, nlags);
+    opt->autocorr(R, x, w, n, nlags);
+
+    /* no lag can exceed the energy at lag 0 */
+
+    err = worst(ref, R, nlags, fmaxf(ref[0], TINY), &index);
+    snprintf(ctx, sizeof(ctx), "n=%d nlags=%d", n, nlags);
+    check_result("autocorr", TOL_AUTOCORR, err, index, nlags, ref[index], R[index], ctx);
+}
+
+/* a value on the boundary of two colours may land in either, so the
+   error is the fraction of pixels that differ */
+
+static void colour_map_check(uint32_t y[], const float x[], int n, float lo,
+			     float scale, const uint32_t lut[256])
+{
+    uint32_t ref[MAX_N];
+    char     ctx[32];
+    int      i, index, differ;
+
+    assert(n <= MAX_N);
+    kernels_scalar.colour_map(ref, x, n, lo, scale, lut);
+    opt->colour_map(y, x, n, lo, scale, lut);
+
+    differ = 0;
+    index = 0;
+    for(i=0; i<n; i++)
+	if (ref[i] != y[i]) {
+	    if (differ++ == 0)
+		index = i;
+	}
+    snprintf(ctx, sizeof(ctx), "x=%g n=%d", n ? x[index] : 0.0, n);
+    check_result("colour_map", TOL_COLOUR_MAP, n ? (float)differ/n : 0.0, index, n,
+		 n ? ref[index] : 0, n ? y[index] : 0, ctx);
+}
+
+static const struct KERNELS kernels_check = {
+    "check",
+    dot_check,
+    cdot_real_check,
+    cmix_check,
+    vq_search_check,
+    bfly4_check,
+    harm_sum_check,
+    osc_bank_check,
+    autocorr_check,
+    colour_map_check
+};
+
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: kernels_check_wrap()
+  DATE CREATED: 19 Oct 2026
+
+  Called by kernels_select("check"), returns a kernel table that runs
+  opt against the scalar reference.  opt must stay valid while check
+  mode is in use.
+
+\*---------------------------------------------------------------------------*/
+
+const struct KERNELS *kernels_check_wrap(const struct KERNELS *k)
+{
+    assert(k != NULL);
+    opt = k;
+
+    return &kernels_check;
+}
+
+int CODEC2_WIN32SUPPORT kernels_checking(void)
+{
+    return kernels == &kernels_check;
+}
+
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: kernels_check_float()
+  DATE CREATED: 19 Oct 2026
+
+  For fast paths outside the kernel table: compares n outputs of an
+  optimised routine with its reference, relative to the peak of the
+  reference, and logs the first divergence under name.  Call only
+  when kernels_checking(), name must be a string constant.  Returns 0
+  if within tol.
+
+\*---------------------------------------------------------------------------*/
+
+int CODEC2_WIN32SUPPORT kernels_check_float(const char *name, const float ref[],
+					    const float res[], int n, float tol)
+{
+    float scale, err;
+    int   i, index;
+    char  ctx[32];
+
+    scale = TINY;
+    for(i=0; i<n; i++)
+	scale = fmaxf(scale, fabsf(ref[i]));
+    err = worst(ref, res, n, scale, &index);
+    snprintf(ctx, sizeof(ctx), "peak %g", scale);
+
+    return check_result(name, tol, err, index, n, n ? ref[index] : 0.0,
+			n ? res[index] : 0.0, ctx);
+}
+
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: kernels_check_stats()
+  DATE CREATED: 19 Oct 2026
+
+  Counters of the i-th kernel checked so far.  Returns 0 once i is past
+  the last one, so callers can loop until it does.
+
+\*---------------------------------------------------------------------------*/
+
+int CODEC2_WIN32SUPPORT kernels_check_stats(int i, struct KERNELS_CHECK_STATS *stats)
+{
+    if ((i < 0) || (i >= nchecks))
+	return 0;
+
+    stats->name     = checks[i].name;
+    stats->calls    = checks[i].calls;
+    stats->failures = checks[i].failures;
+    stats->max_err  = checks[i].max_err;
+
+    return 1;
+}
+
+void CODEC2_WIN32SUPPORT kernels_check_reset(void)
+{
+    int i;
+
+    for(i=0; i<nchecks; i++) {
+	checks[i].calls = 0;
+	checks[i].failures = 0;
+	checks[i].max_err = 0.0;
+    }
+}
@@ -0,0 +1,462 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: kernels_neon.c
+  DATE CREATED: 19 Oct 2026
+
+  NEON versions of the DSP kernels, see kernels.h.  On 32 bit ARM this
+  is the only file built with NEON enabled (the .neon suffix in
+  Android.mk), so the rest of the library still runs on cores without
+  it.  Complex vectors are de-interleaved with vld2q/vst2q.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <assert.h>
+
+#include "kernels.h"
+
+#ifdef KERNELS_HAVE_NEON
+
+#if !defined(__ARM_NEON__) && !defined(__ARM_NEON)
+#error "kernels_neon.c must be built with NEON enabled"
+#endif
+
+#include <arm_neon.h>
+
+static inline float hsum(float32x4_t v)
+{
+    float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+
+    return vget_lane_f32(vpadd_f32(s, s), 0);
+}
+
+static float dot_neon(const float x[], const float h[], int n)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.0);
+    float32x4_t acc1 = vdupq_n_f32(0.0);
+    float       acc;
+    int         i;
+
+    for(i=0; i+8<=n; i+=8) {
+	acc0 = vmlaq_f32(acc0, vld1q_f32(&x[i]),   vld1q_f32(&h[i]));
+	acc1 = vmlaq_f32(acc1, vld1q_f32(&x[i+4]), vld1q_f32(&h[i+4]));
+    }
+    if (i+4 <= n) {
+	acc0 = vmlaq_f32(acc0, vld1q_f32(&x[i]), vld1q_f32(&h[i]));
+	i += 4;
+    }
+    acc = hsum(vaddq_f32(acc0, acc1));
+    for(; i<n; i++)
+	acc += x[i]*h[i];
+
+    return acc;
+}
+
+static COMP cdot_real_neon(const COMP x[], const float h[], int n)
+{
+    float32x4_t   acc_re = vdupq_n_f32(0.0);
+    float32x4_t   acc_im = vdupq_n_f32(0.0);
+    float32x4x2_t x4;
+    float32x4_t   h4;
+    COMP          acc;
+    int           i;
+
+    for(i=0; i+4<=n; i+=4) {
+	x4 = vld2q_f32(&x[i].real);
+	h4 = vld1q_f32(&h[i]);
+	acc_re = vmlaq_f32(acc_re, x4.val[0], h4);
+	acc_im = vmlaq_f32(acc_im, x4.val[1], h4);
+    }
+    acc.real = hsum(acc_re);
+    acc.imag = hsum(acc_im);
+    for(; i<n; i++) {
+	acc.real += h[i]*x[i].real;
+	acc.imag += h[i]*x[i].imag;
+    }
+
+    return acc;
+}
+
+/* four oscillator phases, one per lane, advanced by freq^4 */
+
+static void cmix_neon(COMP y[], const COMP x[], COMP *phase, COMP freq, int n)
+{
+    COMP          ph = *phase, f4;
+    float         p_re[4], p_im[4], re;
+    float32x4_t   pr, pi, lr, li, tr;
+    float32x4_t   sr, si;
+    float32x4x2_t x4, y4;
+    int           i;
+
+    if (n >= 4) {
+	for(i=0; i<4; i++) {
+	    re = ph.real*freq.real - ph.imag*freq.imag;
+	    ph.imag = ph.real*freq.imag + ph.imag*freq.real;
+	    ph.real = re;
+	    p_re[i] = ph.real; p_im[i] = ph.imag;
+	}
+	re = freq.real*freq.real - freq.imag*freq.imag;
+	f4.imag = 2.0*freq.real*freq.imag;
+	f4.real = re*re - f4.imag*f4.imag;
+	f4.imag = 2.0*re*f4.imag;
+
+	pr = lr = vld1q_f32(p_re);
+	pi = li = vld1q_f32(p_im);
+	sr = vdupq_n_f32(f4.real);
+	si = vdupq_n_f32(f4.imag);
+	for(i=0; i+4<=n; i+=4) {
+	    x4 = vld2q_f32(&x[i].real);
+	    y4.val[0] = vmlsq_f32(vmulq_f32(x4.val[0], pr), x4.val[1], pi);
+	    y4.val[1] = vmlaq_f32(vmulq_f32(x4.val[0], pi), x4.val[1], pr);
+	    vst2q_f32(&y[i].real, y4);
+	    lr = pr; li = pi;
+	    tr = vmlsq_f32(vmulq_f32(pr, sr), pi, si);
+	    pi = vmlaq_f32(vmulq_f32(pr, si), pi, sr);
+	    pr = tr;
+	}
+	ph.real = vgetq_lane_f32(lr, 3);
+	ph.imag = vgetq_lane_f32(li, 3);
+    }
+    else
+	i = 0;
+
+    for(; i<n; i++) {
+	re = ph.real*freq.real - ph.imag*freq.imag;
+	ph.imag = ph.real*freq.imag + ph.imag*freq.real;
+	ph.real = re;
+	y[i].real = x[i].real*ph.real - x[i].imag*ph.imag;
+	y[i].imag = x[i].real*ph.imag + x[i].imag*ph.real;
+    }
+
+    *phase = ph;
+}
+
+/* as kernels_sse2.c, short vectors four entries at a time */
+
+static int vq_search_neon(const float cb[], int entries, int ndim,
+			  const float x[], const float w[], float *dist)
+{
+    float         e4[4], beste;
+    float32x4_t   x4, w4, d0, e;
+    float32x4x2_t c4;
+    int           i, j, l, besti;
+
+    besti = 0;
+    beste = 1E32;
+
+    if (ndim == 1) {
+	x4 = vdupq_n_f32(x[0]);
+	w4 = vdupq_n_f32(w ? w[0] : 1.0);
+	for(i=0; i+4<=entries; i+=4) {
+	    d0 = vsubq_f32(x4, vld1q_f32(&cb[i]));
+	    vst1q_f32(e4, vmulq_f32(vmulq_f32(w4, d0), d0));
+	    for(l=0; l<4; l++)
+		if (e4[l] < beste) {
+		    beste = e4[l];
+		    besti = i+l;
+		}
+	}
+    }
+    else if (ndim == 2) {
+	float32x4_t x0 = vdupq_n_f32(x[0]), x1 = vdupq_n_f32(x[1]);
+	float32x4_t w0 = vdupq_n_f32(w ? w[0] : 1.0), w1 = vdupq_n_f32(w ? w[1] : 1.0);
+
+	for(i=0; i+4<=entries; i+=4) {
+	    c4 = vld2q_f32(&cb[2*i]);
+	    d0 = vsubq_f32(x0, c4.val[0]);
+	    e  = vmulq_f32(vmulq_f32(w0, d0), d0);
+	    d0 = vsubq_f32(x1, c4.val[1]);
+	    e  = vaddq_f32(e, vmulq_f32(vmulq_f32(w1, d0), d0));
+	    vst1q_f32(e4, e);
+	    for(l=0; l<4; l++)
+		if (e4[l] < beste) {
+		    beste = e4[l];
+		    besti = i+l;
+		}
+	}
+    }
+    else if (ndim >= 4) {
+	for(i=0; i<entries; i++) {
+	    const float *c = &cb[i*ndim];
+	    float        t, et;
+
+	    e = vdupq_n_f32(0.0);
+	    for(j=0; j+4<=ndim; j+=4) {
+		d0 = vsubq_f32(vld1q_f32(&x[j]), vld1q_f32(&c[j]));
+		w4 = w ? vld1q_f32(&w[j]) : vdupq_n_f32(1.0);
+		e = vaddq_f32(e, vmulq_f32(vmulq_f32(w4, d0), d0));
+	    }
+	    et = hsum(e);
+	    for(; j<ndim; j++) {
+		t = x[j] - c[j];
+		et += (w ? w[j] : 1.0)*t*t;
+	    }
+	    if (et < beste) {
+		beste = et;
+		besti = i;
+	    }
+	}
+	i = entries;
+    }
+    else
+	i = 0;
+
+    /* left over entries */
+
+    if (i < entries) {
+	j = i + kernels_scalar.vq_search(&cb[i*ndim], entries-i, ndim, x, w, &e4[0]);
+	if (e4[0] < beste) {
+	    beste = e4[0];
+	    besti = j;
+	}
+    }
+
+    if (dist != NULL)
+	*dist = beste;
+
+    return besti;
+}
+
+/* two complex multiplies on interleaved data, a*b */
+
+static inline float32x4_t cmul2(float32x4_t a, float32x4_t b)
+{
+    const float32x4_t sign = { -1.0f, 1.0f, -1.0f, 1.0f };
+    float32x4x2_t     bt = vtrnq_f32(b, b);   /* [re re ..], [im im ..] */
+
+    return vmlaq_f32(vmulq_f32(a, bt.val[0]),
+		     vmulq_f32(vrev64q_f32(a), bt.val[1]), sign);
+}
+
+static inline float32x4_t load2(const COMP *a, const COMP *b)
+{
+    return vcombine_f32(vld1_f32(&a->real), vld1_f32(&b->real));
+}
+
+static void bfly4_neon(COMP Fout[], const COMP tw[], int fstride, int m, int inverse)
+{
+    const float32x4_t fwd = { 1.0f, -1.0f, 1.0f, -1.0f };
+    const float32x4_t inv = { -1.0f, 1.0f, -1.0f, 1.0f };
+    float32x4_t rot = inverse ? inv : fwd;
+    float32x4_t f0, f1, f2, f3, s0, s1, s2, s3, s4, s5;
+    int         k, odd;
+
+    for(k=0; k<m; k+=2) {
+
+	/* odd m, last column is done on its own in both halves */
+
+	odd = (k+1 == m);
+	if (!odd) {
+	    f0 = vld1q_f32(&Fout[k].real);
+	    f1 = vld1q_f32(&Fout[k+m].real);
+	    f2 = vld1q_f32(&Fout[k+2*m].real);
+	    f3 = vld1q_f32(&Fout[k+3*m].real);
+	    s0 = cmul2(f1, load2(&tw[k*fstride],   &tw[(k+1)*fstride]));
+	    s1 = cmul2(f2, load2(&tw[2*k*fstride], &tw[2*(k+1)*fstride]));
+	    s2 = cmul2(f3, load2(&tw[3*k*fstride], &tw[3*(k+1)*fstride]));
+	}
+	else {
+	    f0 = load2(&Fout[k], &Fout[k]);
+	    f1 = load2(&Fout[k+m], &Fout[k+m]);
+	    f2 = load2(&Fout[k+2*m], &Fout[k+2*m]);
+	    f3 = load2(&Fout[k+3*m], &Fout[k+3*m]);
+	    s0 = cmul2(f1, load2(&tw[k*fstride],   &tw[k*fstride]));
+	    s1 = cmul2(f2, load2(&tw[2*k*fstride], &tw[2*k*fstride]));
+	    s2 = cmul2(f3, load2(&tw[3*k*fstride], &tw[3*k*fstride]));
+	}
+
+	s5 = vsubq_f32(f0, s1);
+	f0 = vaddq_f32(f0, s1);
+	s3 = vaddq_f32(s0, s2);
+	s4 = vsubq_f32(s0, s2);
+	f2 = vsubq_f32(f0, s3);
+	f0 = vaddq_f32(f0, s3);
+
+	/* s4 times -j (forward) or +j (inverse) */
+
+	s4 = vmulq_f32(vrev64q_f32(s4), rot);
+	f1 = vaddq_f32(s5, s4);
+	f3 = vsubq_f32(s5, s4);
+
+	if (!odd) {
+	    vst1q_f32(&Fout[k].real, f0);
+	    vst1q_f32(&Fout[k+m].real, f1);
+	    vst1q_f32(&Fout[k+2*m].real, f2);
+	    vst1q_f32(&Fout[k+3*m].real, f3);
+	}
+	else {
+	    vst1_f32(&Fout[k].real, vget_low_f32(f0));
+	    vst1_f32(&Fout[k+m].real, vget_low_f32(f1));
+	    vst1_f32(&Fout[k+2*m].real, vget_low_f32(f2));
+	    vst1_f32(&Fout[k+3*m].real, vget_low_f32(f3));
+	}
+    }
+}
+
+/* four candidates per register, NEON has no gather so the bins are
+   stored and loaded one by one */
+
+static void harm_sum_neon(const float Pw[], const float k[], int ncand, int L,
+			  float E[])
+{
+    float       kk[4], p[4], e[4];
+    int32_t     b[4];
+    float32x4_t k4, mf, acc;
+    int         c, m, i;
+
+    for(c=0; c<ncand; c+=4) {
+	for(i=0; i<4; i++)
+	    kk[i] = (c+i < ncand) ? k[c+i] : 0.0;
+	k4  = vld1q_f32(kk);
+	mf  = vdupq_n_f32(0.0);
+	acc = vdupq_n_f32(0.0);
+	for(m=1; m<=L; m++) {
+	    mf = vaddq_f32(mf, vdupq_n_f32(1.0));
+	    vst1q_s32(b, vcvtq_s32_f32(vaddq_f32(vmulq_f32(mf, k4), vdupq_n_f32(0.5))));
+	    p[0] = Pw[b[0]]; p[1] = Pw[b[1]]; p[2] = Pw[b[2]]; p[3] = Pw[b[3]];
+	    acc = vaddq_f32(acc, vld1q_f32(p));
+	}
+	vst1q_f32(e, acc);
+	for(i=0; (i<4) && (c+i<ncand); i++)
+	    E[c+i] = e[i];
+    }
+}
+
+/* four oscillators per register, as kernels_sse2.c */
+
+static void osc_bank_neon(float y[], float re[], float im[], const float cr[],
+			  const float ci[], int nosc, int n)
+{
+    float32x4_t r[128/4], q[128/4], c[128/4], s[128/4];
+    float32x4_t acc, t;
+    float       b[4][4];
+    int         i, g, ng, j, l;
+
+    assert(nosc <= 128);
+    ng = (nosc + 3)/4;
+
+    /* a short last group is padded with zero phasors */
+
+    for(g=0; g<ng; g++) {
+	for(j=0; j<4; j++) {
+	    l = g*4 + j;
+	    b[0][j] = (l < nosc) ? re[l] : 0.0;
+	    b[1][j] = (l < nosc) ? im[l] : 0.0;
+	    b[2][j] = (l < nosc) ? cr[l] : 1.0;
+	    b[3][j] = (l < nosc) ? ci[l] : 0.0;
+	}
+	r[g] = vld1q_f32(b[0]); q[g] = vld1q_f32(b[1]);
+	c[g] = vld1q_f32(b[2]); s[g] = vld1q_f32(b[3]);
+    }
+
+    for(i=0; i<n; i++) {
+	acc = vdupq_n_f32(0.0);
+	for(g=0; g<ng; g++) {
+	    acc  = vaddq_f32(acc, r[g]);
+	    t    = vmlsq_f32(vmulq_f32(r[g], c[g]), q[g], s[g]);
+	    q[g] = vmlaq_f32(vmulq_f32(r[g], s[g]), q[g], c[g]);
+	    r[g] = t;
+	}
+	y[i] = hsum(acc);
+    }
+
+    for(g=0; g<ng; g++) {
+	vst1q_f32(b[0], r[g]); vst1q_f32(b[1], q[g]);
+	for(j=0; j<4; j++) {
+	    l = g*4 + j;
+	    if (l < nosc) {
+		re[l] = b[0][j];
+		im[l] = b[1][j];
+	    }
+	}
+    }
+}
+
+/* four lags at a time, as kernels_sse2.c */
+
+static void autocorr_neon(float R[], const float x[], const float w[], int n,
+			  int nlags)
+{
+    float       s[512 + 40];
+    float32x4_t a, acc0, acc1, acc2, acc3;
+    float       r[4];
+    int         i, j, k;
+
+    assert((n <= 512) && (nlags <= 32));
+    for(i=0; i<n; i++)
+	s[i] = w ? x[i]*w[i] : x[i];
+    for(; i<n+40; i++)
+	s[i] = 0.0;
+
+    for(j=0; j<nlags; j+=4) {
+	acc0 = acc1 = acc2 = acc3 = vdupq_n_f32(0.0);
+	for(i=0; i<n; i+=4) {
+	    a = vld1q_f32(&s[i]);
+	    acc0 = vmlaq_f32(acc0, a, vld1q_f32(&s[i+j]));
+	    acc1 = vmlaq_f32(acc1, a, vld1q_f32(&s[i+j+1]));
+	    acc2 = vmlaq_f32(acc2, a, vld1q_f32(&s[i+j+2]));
+	    acc3 = vmlaq_f32(acc3, a, vld1q_f32(&s[i+j+3]));
+	}
+	r[0] = hsum(acc0); r[1] = hsum(acc1); r[2] = hsum(acc2); r[3] = hsum(acc3);
+	for(k=0; (k<4) && (j+k<nlags); k++)
+	    R[j+k] = r[k];
+    }
+}
+
+/* four pixels at a time, the LUT lookups are scalar */
+
+static void colour_map_neon(uint32_t y[], const float x[], int n, float lo,
+			    float scale, const uint32_t lut[256])
+{
+    float32x4_t vlo = vdupq_n_f32(lo), vscale = vdupq_n_f32(scale);
+    float32x4_t zero = vdupq_n_f32(0.0f), top = vdupq_n_f32(255.0f);
+    float32x4_t v;
+    uint32_t    q[4];
+    float       t;
+    int         i;
+
+    for(i=0; i+4<=n; i+=4) {
+	v = vmulq_f32(vsubq_f32(vld1q_f32(&x[i]), vlo), vscale);
+	v = vminq_f32(vmaxq_f32(v, zero), top);
+	vst1q_u32(q, vcvtq_u32_f32(v));
+	y[i]   = lut[q[0]];
+	y[i+1] = lut[q[1]];
+	y[i+2] = lut[q[2]];
+	y[i+3] = lut[q[3]];
+    }
+    for(; i<n; i++) {
+	t = (x[i] - lo)*scale;
+	if (t < 0.0f)   t = 0.0f;
+	if (t > 255.0f) t = 255.0f;
+	y[i] = lut[(int)t];
+    }
+}
+
+const struct KERNELS kernels_neon = {
+    "neon",
+    dot_neon,
+    cdot_real_neon,
+    cmix_neon,
+    vq_search_neon,
+    bfly4_neon,
+    harm_sum_neon,
+    osc_bank_neon,
+    autocorr_neon,
+    colour_map_neon
+};
+
+#endif
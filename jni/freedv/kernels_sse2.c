@@ -0,0 +1,433 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: kernels_sse2.c
+  DATE CREATED: 19 Oct 2026
+
+  SSE2 versions of the DSP kernels, see kernels.h.  Complex values are
+  processed two per register in their natural interleaved order.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <assert.h>
+
+#include "kernels.h"
+
+#ifdef KERNELS_HAVE_SSE2
+
+#include <emmintrin.h>
+
+/* lets us build without -msse2 on 32 bit x86 */
+
+#define SSE2 __attribute__((target("sse2")))
+
+SSE2 static inline float hsum(__m128 v)
+{
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_add_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1,1,1,1)));
+    return _mm_cvtss_f32(v);
+}
+
+/* two complex multiplies, a*b.  Signs are flipped by multiplying
+   rather than xor-ing the sign bit, as with -ffast-math the compiler
+   may treat 0.0 and -0.0 masks as equal. */
+
+SSE2 static inline __m128 cmul2(__m128 a, __m128 b)
+{
+    const __m128 neg_re = _mm_setr_ps(-1.0, 1.0, -1.0, 1.0);
+    __m128 b_re = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2,2,0,0));
+    __m128 b_im = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3,3,1,1));
+    __m128 a_sw = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2,3,0,1));
+
+    return _mm_add_ps(_mm_mul_ps(a, b_re),
+		      _mm_mul_ps(_mm_mul_ps(a_sw, b_im), neg_re));
+}
+
+SSE2 static inline __m128 load2(const COMP *a, const COMP *b)
+{
+    __m128 v = _mm_setzero_ps();
+
+    v = _mm_loadl_pi(v, (const __m64 *)a);
+    return _mm_loadh_pi(v, (const __m64 *)b);
+}
+
+SSE2 static float dot_sse2(const float x[], const float h[], int n)
+{
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    float  acc;
+    int    i;
+
+    for(i=0; i+8<=n; i+=8) {
+	acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&x[i]),   _mm_loadu_ps(&h[i])));
+	acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&x[i+4]), _mm_loadu_ps(&h[i+4])));
+    }
+    acc = hsum(_mm_add_ps(acc0, acc1));
+    for(; i<n; i++)
+	acc += x[i]*h[i];
+
+    return acc;
+}
+
+SSE2 static COMP cdot_real_sse2(const COMP x[], const float h[], int n)
+{
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    __m128 h4;
+    COMP   acc;
+    int    i;
+
+    for(i=0; i+4<=n; i+=4) {
+	h4 = _mm_loadu_ps(&h[i]);
+	acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&x[i].real),
+					   _mm_unpacklo_ps(h4, h4)));
+	acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&x[i+2].real),
+					   _mm_unpackhi_ps(h4, h4)));
+    }
+    acc0 = _mm_add_ps(acc0, acc1);
+    acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+    acc.real = _mm_cvtss_f32(acc0);
+    acc.imag = _mm_cvtss_f32(_mm_shuffle_ps(acc0, acc0, _MM_SHUFFLE(1,1,1,1)));
+    for(; i<n; i++) {
+	acc.real += h[i]*x[i].real;
+	acc.imag += h[i]*x[i].imag;
+    }
+
+    return acc;
+}
+
+/* two oscillator phases per register, advanced by freq^2 */
+
+SSE2 static void cmix_sse2(COMP y[], const COMP x[], COMP *phase, COMP freq, int n)
+{
+    COMP   ph = *phase, ph2[2];
+    COMP   f2;
+    __m128 p, last, step;
+    float  re;
+    int    i;
+
+    if (n >= 2) {
+	ph2[0].real = ph.real*freq.real - ph.imag*freq.imag;
+	ph2[0].imag = ph.real*freq.imag + ph.imag*freq.real;
+	ph2[1].real = ph2[0].real*freq.real - ph2[0].imag*freq.imag;
+	ph2[1].imag = ph2[0].real*freq.imag + ph2[0].imag*freq.real;
+	f2.real = freq.real*freq.real - freq.imag*freq.imag;
+	f2.imag = 2.0*freq.real*freq.imag;
+
+	p = last = _mm_loadu_ps(&ph2[0].real);
+	step = _mm_setr_ps(f2.real, f2.imag, f2.real, f2.imag);
+	for(i=0; i+2<=n; i+=2) {
+	    _mm_storeu_ps(&y[i].real, cmul2(_mm_loadu_ps(&x[i].real), p));
+	    last = p;
+	    p = cmul2(p, step);
+	}
+	_mm_storeu_ps(&ph2[0].real, last);
+	ph = ph2[1];
+    }
+    else
+	i = 0;
+
+    for(; i<n; i++) {
+	re = ph.real*freq.real - ph.imag*freq.imag;
+	ph.imag = ph.real*freq.imag + ph.imag*freq.real;
+	ph.real = re;
+	y[i].real = x[i].real*ph.real - x[i].imag*ph.imag;
+	y[i].imag = x[i].real*ph.imag + x[i].imag*ph.real;
+    }
+
+    *phase = ph;
+}
+
+/* 1 and 2 dimensional codebooks are searched four entries at a time,
+   larger ones one entry at a time across the dimensions */
+
+SSE2 static int vq_search_sse2(const float cb[], int entries, int ndim,
+			       const float x[], const float w[], float *dist)
+{
+    float  e4[4], beste;
+    __m128 x4, w4, d0, d1, e;
+    int    i, j, l, besti;
+
+    besti = 0;
+    beste = 1E32;
+
+    if (ndim == 1) {
+	x4 = _mm_set1_ps(x[0]);
+	w4 = _mm_set1_ps(w ? w[0] : 1.0);
+	for(i=0; i+4<=entries; i+=4) {
+	    d0 = _mm_sub_ps(x4, _mm_loadu_ps(&cb[i]));
+	    _mm_storeu_ps(e4, _mm_mul_ps(_mm_mul_ps(w4, d0), d0));
+	    for(l=0; l<4; l++)
+		if (e4[l] < beste) {
+		    beste = e4[l];
+		    besti = i+l;
+		}
+	}
+    }
+    else if (ndim == 2) {
+	x4 = _mm_setr_ps(x[0], x[1], x[0], x[1]);
+	w4 = w ? _mm_setr_ps(w[0], w[1], w[0], w[1]) : _mm_set1_ps(1.0);
+	for(i=0; i+4<=entries; i+=4) {
+	    d0 = _mm_sub_ps(x4, _mm_loadu_ps(&cb[2*i]));
+	    d1 = _mm_sub_ps(x4, _mm_loadu_ps(&cb[2*i+4]));
+	    d0 = _mm_mul_ps(_mm_mul_ps(w4, d0), d0);
+	    d1 = _mm_mul_ps(_mm_mul_ps(w4, d1), d1);
+	    e = _mm_add_ps(_mm_shuffle_ps(d0, d1, _MM_SHUFFLE(2,0,2,0)),
+			   _mm_shuffle_ps(d0, d1, _MM_SHUFFLE(3,1,3,1)));
+	    _mm_storeu_ps(e4, e);
+	    for(l=0; l<4; l++)
+		if (e4[l] < beste) {
+		    beste = e4[l];
+		    besti = i+l;
+		}
+	}
+    }
+    else if (ndim >= 4) {
+	for(i=0; i<entries; i++) {
+	    const float *c = &cb[i*ndim];
+	    float        t, et;
+
+	    e = _mm_setzero_ps();
+	    for(j=0; j+4<=ndim; j+=4) {
+		d0 = _mm_sub_ps(_mm_loadu_ps(&x[j]), _mm_loadu_ps(&c[j]));
+		w4 = w ? _mm_loadu_ps(&w[j]) : _mm_set1_ps(1.0);
+		e = _mm_add_ps(e, _mm_mul_ps(_mm_mul_ps(w4, d0), d0));
+	    }
+	    et = hsum(e);
+	    for(; j<ndim; j++) {
+		t = x[j] - c[j];
+		et += (w ? w[j] : 1.0)*t*t;
+	    }
+	    if (et < beste) {
+		beste = et;
+		besti = i;
+	    }
+	}
+	i = entries;
+    }
+    else
+	i = 0;
+
+    /* left over entries */
+
+    if (i < entries) {
+	j = i + kernels_scalar.vq_search(&cb[i*ndim], entries-i, ndim, x, w, &e4[0]);
+	if (e4[0] < beste) {
+	    beste = e4[0];
+	    besti = j;
+	}
+    }
+
+    if (dist != NULL)
+	*dist = beste;
+
+    return besti;
+}
+
+/* radix 4 butterfly on two columns at once, odd m finishes with one */
+
+SSE2 static inline void bfly4_core(__m128 *f0, __m128 *f1, __m128 *f2, __m128 *f3,
+				   __m128 t1, __m128 t2, __m128 t3, __m128 rot)
+{
+    __m128 s0, s1, s2, s3, s4, s5;
+
+    s0 = cmul2(*f1, t1);
+    s1 = cmul2(*f2, t2);
+    s2 = cmul2(*f3, t3);
+
+    s5 = _mm_sub_ps(*f0, s1);
+    *f0 = _mm_add_ps(*f0, s1);
+    s3 = _mm_add_ps(s0, s2);
+    s4 = _mm_sub_ps(s0, s2);
+    *f2 = _mm_sub_ps(*f0, s3);
+    *f0 = _mm_add_ps(*f0, s3);
+
+    /* s4 times -j (forward) or +j (inverse) */
+
+    s4 = _mm_mul_ps(_mm_shuffle_ps(s4, s4, _MM_SHUFFLE(2,3,0,1)), rot);
+    *f1 = _mm_add_ps(s5, s4);
+    *f3 = _mm_sub_ps(s5, s4);
+}
+
+SSE2 static void bfly4_sse2(COMP Fout[], const COMP tw[], int fstride, int m, int inverse)
+{
+    __m128 rot, f0, f1, f2, f3, t1, t2, t3;
+    int    k;
+
+    if (inverse)
+	rot = _mm_setr_ps(-1.0, 1.0, -1.0, 1.0);
+    else
+	rot = _mm_setr_ps(1.0, -1.0, 1.0, -1.0);
+
+    for(k=0; k+2<=m; k+=2) {
+	f0 = _mm_loadu_ps(&Fout[k].real);
+	f1 = _mm_loadu_ps(&Fout[k+m].real);
+	f2 = _mm_loadu_ps(&Fout[k+2*m].real);
+	f3 = _mm_loadu_ps(&Fout[k+3*m].real);
+	t1 = load2(&tw[k*fstride],   &tw[(k+1)*fstride]);
+	t2 = load2(&tw[2*k*fstride], &tw[2*(k+1)*fstride]);
+	t3 = load2(&tw[3*k*fstride], &tw[3*(k+1)*fstride]);
+	bfly4_core(&f0, &f1, &f2, &f3, t1, t2, t3, rot);
+	_mm_storeu_ps(&Fout[k].real, f0);
+	_mm_storeu_ps(&Fout[k+m].real, f1);
+	_mm_storeu_ps(&Fout[k+2*m].real, f2);
+	_mm_storeu_ps(&Fout[k+3*m].real, f3);
+    }
+
+    if (k < m) {
+	f0 = load2(&Fout[k], &Fout[k]);
+	f1 = load2(&Fout[k+m], &Fout[k+m]);
+	f2 = load2(&Fout[k+2*m], &Fout[k+2*m]);
+	f3 = load2(&Fout[k+3*m], &Fout[k+3*m]);
+	t1 = load2(&tw[k*fstride], &tw[k*fstride]);
+	t2 = load2(&tw[2*k*fstride], &tw[2*k*fstride]);
+	t3 = load2(&tw[3*k*fstride], &tw[3*k*fstride]);
+	bfly4_core(&f0, &f1, &f2, &f3, t1, t2, t3, rot);
+	_mm_storel_pi((__m64 *)&Fout[k], f0);
+	_mm_storel_pi((__m64 *)&Fout[k+m], f1);
+	_mm_storel_pi((__m64 *)&Fout[k+2*m], f2);
+	_mm_storel_pi((__m64 *)&Fout[k+3*m], f3);
+    }
+}
+
+/* four oscillators per register.  The groups of four are independent
+   so the sample loop is on the outside, letting the rotations of
+   several groups overlap rather than waiting on one group's chain of
+   multiplies. */
+
+SSE2 static void osc_bank_sse2(float y[], float re[], float im[], const float cr[],
+			       const float ci[], int nosc, int n)
+{
+    __m128 r[128/4], q[128/4], c[128/4], s[128/4];
+    __m128 acc, t;
+    float  b[4][4];
+    int    i, g, ng, j, l;
+
+    assert(nosc <= 128);
+    ng = (nosc + 3)/4;
+
+    /* a short last group is padded with zero phasors */
+
+    for(g=0; g<ng; g++) {
+	for(j=0; j<4; j++) {
+	    l = g*4 + j;
+	    b[0][j] = (l < nosc) ? re[l] : 0.0;
+	    b[1][j] = (l < nosc) ? im[l] : 0.0;
+	    b[2][j] = (l < nosc) ? cr[l] : 1.0;
+	    b[3][j] = (l < nosc) ? ci[l] : 0.0;
+	}
+	r[g] = _mm_loadu_ps(b[0]); q[g] = _mm_loadu_ps(b[1]);
+	c[g] = _mm_loadu_ps(b[2]); s[g] = _mm_loadu_ps(b[3]);
+    }
+
+    for(i=0; i<n; i++) {
+	acc = _mm_setzero_ps();
+	for(g=0; g<ng; g++) {
+	    acc  = _mm_add_ps(acc, r[g]);
+	    t    = _mm_sub_ps(_mm_mul_ps(r[g], c[g]), _mm_mul_ps(q[g], s[g]));
+	    q[g] = _mm_add_ps(_mm_mul_ps(r[g], s[g]), _mm_mul_ps(q[g], c[g]));
+	    r[g] = t;
+	}
+	y[i] = hsum(acc);
+    }
+
+    for(g=0; g<ng; g++) {
+	_mm_storeu_ps(b[0], r[g]); _mm_storeu_ps(b[1], q[g]);
+	for(j=0; j<4; j++) {
+	    l = g*4 + j;
+	    if (l < nosc) {
+		re[l] = b[0][j];
+		im[l] = b[1][j];
+	    }
+	}
+    }
+}
+
+/* four lags at a time, one per accumulator, so each vector of samples
+   is loaded once for the four.  s[] is zero padded past n so the last
+   vectors are whole. */
+
+SSE2 static void autocorr_sse2(float R[], const float x[], const float w[], int n,
+			       int nlags)
+{
+    float  s[512 + 40];
+    __m128 a, acc0, acc1, acc2, acc3;
+    float  r[4];
+    int    i, j, k;
+
+    assert((n <= 512) && (nlags <= 32));
+    for(i=0; i<n; i++)
+	s[i] = w ? x[i]*w[i] : x[i];
+    for(; i<n+40; i++)
+	s[i] = 0.0;
+
+    for(j=0; j<nlags; j+=4) {
+	acc0 = acc1 = acc2 = acc3 = _mm_setzero_ps();
+	for(i=0; i<n; i+=4) {
+	    a = _mm_loadu_ps(&s[i]);
+	    acc0 = _mm_add_ps(acc0, _mm_mul_ps(a, _mm_loadu_ps(&s[i+j])));
+	    acc1 = _mm_add_ps(acc1, _mm_mul_ps(a, _mm_loadu_ps(&s[i+j+1])));
+	    acc2 = _mm_add_ps(acc2, _mm_mul_ps(a, _mm_loadu_ps(&s[i+j+2])));
+	    acc3 = _mm_add_ps(acc3, _mm_mul_ps(a, _mm_loadu_ps(&s[i+j+3])));
+	}
+	r[0] = hsum(acc0); r[1] = hsum(acc1); r[2] = hsum(acc2); r[3] = hsum(acc3);
+	for(k=0; (k<4) && (j+k<nlags); k++)
+	    R[j+k] = r[k];
+    }
+}
+
+/* no gather in SSE2, the four indexes go through memory */
+
+SSE2 static void colour_map_sse2(uint32_t y[], const float x[], int n, float lo,
+				 float scale, const uint32_t lut[256])
+{
+    __m128 vlo = _mm_set1_ps(lo), vscale = _mm_set1_ps(scale);
+    __m128 zero = _mm_setzero_ps(), top = _mm_set1_ps(255.0f);
+    __m128 v;
+    int    q[4];
+    int    i;
+
+    for(i=0; i+4<=n; i+=4) {
+	v = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&x[i]), vlo), vscale);
+	v = _mm_min_ps(_mm_max_ps(v, zero), top);
+	_mm_storeu_si128((__m128i *)q, _mm_cvttps_epi32(v));
+	y[i]   = lut[q[0]];
+	y[i+1] = lut[q[1]];
+	y[i+2] = lut[q[2]];
+	y[i+3] = lut[q[3]];
+    }
+    for(; i<n; i++) {
+	v = _mm_mul_ss(_mm_sub_ss(_mm_load_ss(&x[i]), vlo), vscale);
+	v = _mm_min_ss(_mm_max_ss(v, zero), top);
+	y[i] = lut[_mm_cvttss_si32(v)];
+    }
+}
+
+const struct KERNELS kernels_sse2 = {
+    "sse2",
+    dot_sse2,
+    cdot_real_sse2,
+    cmix_sse2,
+    vq_search_sse2,
+    bfly4_sse2,
+    NULL,                       /* no gather, no faster than scalar */
+    osc_bank_sse2,
+    autocorr_sse2,
+    colour_map_sse2
+};
+
+#endif
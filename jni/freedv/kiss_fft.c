@@ -14,6 +14,7 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
 
 
 #include "_kiss_fft_guts.h"
+#include "kernels.h"
 /* The guts header contains all the multiplication and addition macros that are defined for
  fixed or floating point complex numbers.  It also delares the kf_ internal functions.
  */
@@ -48,6 +49,11 @@ static void kf_bfly4(
         const size_t m
         )
 {
+#ifndef FIXED_POINT
+    /* float builds use the run time selected (SIMD) version, see kernels.h */
+
+    kernels->bfly4((COMP *)Fout, (const COMP *)st->twiddles, fstride, m, st->inverse);
+#else
     kiss_fft_cpx *tw1,*tw2,*tw3;
     kiss_fft_cpx scratch[6];
     size_t k=m;
@@ -87,6 +93,7 @@ static void kf_bfly4(
         }
         ++Fout;
     }while(--k);
+#endif
 }
 
 static void kf_bfly3(
@@ -351,6 +358,7 @@ kiss_fft_cfg kiss_fft_alloc(int nfft,int inverse_fft,void * mem,size_t * lenmem
     }
     if (st) {
         int i;
+        kernels_init();
         st->nfft=nfft;
         st->inverse = inverse_fft;
 
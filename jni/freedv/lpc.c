@@ -33,8 +33,10 @@
 
 #include <assert.h>
 #include <math.h>
+#include <stddef.h>
 #include "defines.h"
 #include "lpc.h"
+#include "kernels.h"
 
 /*---------------------------------------------------------------------------*\
                                                                          
@@ -126,13 +128,31 @@ void autocorrelate(
   int order	/* order of LPC analysis */
 )
 {
-  int i,j;	/* loop variables */
+  assert(Nsam <= LPC_MAX_N);
+  kernels->autocorr(Rn, Sn, NULL, Nsam, order+1);
+}
 
-  for(j=0; j<order+1; j++) {
-    Rn[j] = 0.0;
-    for(i=0; i<Nsam-j; i++)
-      Rn[j] += Sn[i]*Sn[i+j];
-  }
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: autocorrelate_windowed()
+  DATE CREATED: 19 Oct 2026
+
+  As autocorrelate() but applies the window w[] to the unwindowed
+  samples Sn[] on the way, saving the caller a windowed copy of the
+  frame.
+
+\*---------------------------------------------------------------------------*/
+
+void autocorrelate_windowed(
+  float Sn[],	/* frame of Nsam speech samples */
+  float w[],	/* Nsam window samples */
+  float Rn[],	/* array of P+1 autocorrelation coefficients */
+  int Nsam,	/* number of samples to use */
+  int order	/* order of LPC analysis */
+)
+{
+  assert(Nsam <= LPC_MAX_N);
+  kernels->autocorr(Rn, Sn, w, Nsam, order+1);
 }
 
 /*---------------------------------------------------------------------------*\
@@ -156,32 +176,36 @@ void levinson_durbin(
   int order		/* order of the LPC analysis */
 )
 {
-  float E[LPC_MAX+1];
-  float k[LPC_MAX+1];
-  float a[LPC_MAX+1][LPC_MAX+1];
-  float sum;
-  int i,j;				/* loop variables */
+  float E, k, sum, aj, al;
+  int i,j,l;				/* loop variables */
 
-  E[0] = R[0];				/* Equation 38a, Makhoul */
+  /* the order i predictor is built in place over the order i-1 one in
+     lpcs[], updating a[j] and a[i-j] as a pair so both read the old
+     values */
+
+  E = R[0];				/* Equation 38a, Makhoul */
 
   for(i=1; i<=order; i++) {
     sum = 0.0;
     for(j=1; j<=i-1; j++)
-      sum += a[i-1][j]*R[i-j];
-    k[i] = -1.0*(R[i] + sum)/E[i-1];	/* Equation 38b, Makhoul */
-    if (fabsf(k[i]) > 1.0)
-      k[i] = 0.0;
-
-    a[i][i] = k[i];
-
-    for(j=1; j<=i-1; j++)
-      a[i][j] = a[i-1][j] + k[i]*a[i-1][i-j];	/* Equation 38c, Makhoul */
+      sum += lpcs[j]*R[i-j];
+    k = -1.0*(R[i] + sum)/E;		/* Equation 38b, Makhoul */
+    if (fabsf(k) > 1.0)
+      k = 0.0;
+
+    for(j=1, l=i-1; j<l; j++, l--) {	/* Equation 38c, Makhoul */
+      aj  = lpcs[j];
+      al  = lpcs[l];
+      lpcs[j] = aj + k*al;
+      lpcs[l] = al + k*aj;
+    }
+    if (j == l)
+      lpcs[j] = lpcs[j] + k*lpcs[j];
+    lpcs[i] = k;
 
-    E[i] = (1-k[i]*k[i])*E[i-1];		/* Equation 38d, Makhoul */
+    E = (1-k*k)*E;			/* Equation 38d, Makhoul */
   }
 
-  for(i=1; i<=order; i++)
-    lpcs[i] = a[order][i];
   lpcs[0] = 1.0;  
 }
 
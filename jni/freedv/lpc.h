@@ -34,6 +34,7 @@ void pre_emp(float Sn_pre[], float Sn[], float *mem, int Nsam);
 void de_emp(float Sn_se[], float Sn[], float *mem, int Nsam);
 void hanning_window(float Sn[],	float Wn[], int Nsam);
 void autocorrelate(float Sn[], float Rn[], int Nsam, int order);
+void autocorrelate_windowed(float Sn[], float w[], float Rn[], int Nsam, int order);
 void levinson_durbin(float R[],	float lpcs[], int order);
 void inverse_filter(float Sn[], float a[], int Nsam, float res[], int order);
 void synthesis_filter(float res[], float a[], int Nsam,	int order, float Sn_[]);
@@ -9,6 +9,11 @@
   LPC conversion. Note that the LSP coefficients are not in radians
   format but in the x domain of the unit circle.
 
+  To test the root finding:
+
+    $ gcc lsp.c -o lsp -DLSP_UNITTEST -O3 -ffast-math -Wall -lm
+    $ ./lsp
+
 \*---------------------------------------------------------------------------*/
 
 /*
@@ -37,6 +42,10 @@
 /* Only 10 gets used, so far. */
 #define LSP_MAX_ORDER	20
 
+#define LSP_GRID	32	/* grid points evaluated per block		*/
+#define LSP_ITER_MAX	16	/* Newton steps per root			*/
+#define LSP_COARSE	4	/* coarse grid spacing, multiple of delta	*/
+
 /*---------------------------------------------------------------------------*\
 
   Introduction to Line Spectrum Pairs (LSPs)
@@ -74,93 +83,84 @@
 
 \*---------------------------------------------------------------------------*/
 
+/* Clenshaw's recurrence for the value and, if dy isn't NULL, the
+   derivative at each point, b[i] = c[i] + 2*x*b[i+1] - b[i+2] and
+   d[i] = 2*b[i+1] + 2*x*d[i+1] - d[i+2] where c[i] = coef[m/2-i] */
+
+static inline void cheb_eva(float y[], float dy[], float *coef, const float x[],
+			    int n, int m)
+{
+    int   i,k;
+    float b0,b1,b2,d0,d1,d2;
+
+    for(k=0;k<n;k++) {
+	b1 = b2 = d1 = d2 = 0.0;
+	for(i=0;i<m/2;i++) {
+	    d0 = 2*b1 + 2*x[k]*d1 - d2;
+	    b0 = coef[i] + 2*x[k]*b1 - b2;
+	    d2 = d1;
+	    d1 = d0;
+	    b2 = b1;
+	    b1 = b0;
+	}
+	y[k] = coef[m/2] + x[k]*b1 - b2;
+	if (dy)
+	    dy[k] = b1 + x[k]*d1 - d2;
+    }
+}
+
 /*---------------------------------------------------------------------------*\
 
   FUNCTION....: cheb_poly_eva()
   AUTHOR......: David Rowe
   DATE CREATED: 24/2/93
 
-  This function evalutes a series of chebyshev polynomials
-
-  FIXME: performing memory allocation at run time is very inefficient,
-  replace with stack variables of MAX_P size.
+  This function evalutes a series of chebyshev polynomials at the n
+  points x[], and their derivative if dy[] isn't NULL.  The points are
+  independent so the compiler can vectorise across them, which it
+  does once it knows the order, so LPC_ORD gets its own copy.
 
 \*---------------------------------------------------------------------------*/
 
-
-static float
-cheb_poly_eva(float *coef,float x,int m)
+static void
+cheb_poly_eva(float y[], float dy[], float *coef, const float x[], int n, int m)
+/*  float y[]		value of the polynomial at each point		*/
+/*  float dy[]		derivative at each point, or NULL		*/
 /*  float coef[]  	coefficients of the polynomial to be evaluated 	*/
-/*  float x   		the point where polynomial is to be evaluated 	*/
+/*  float x[]  		the points where polynomial is to be evaluated 	*/
+/*  int n		number of points				*/
 /*  int m 		order of the polynomial 			*/
 {
-    int i;
-    float *t,*u,*v,sum;
-    float T[(LSP_MAX_ORDER / 2) + 1];
-
-    /* Initialise pointers */
-
-    t = T;                          	/* T[i-2] 			*/
-    *t++ = 1.0;
-    u = t--;                        	/* T[i-1] 			*/
-    *u++ = x;
-    v = u--;                        	/* T[i] 			*/
-
-    /* Evaluate chebyshev series formulation using iterative approach 	*/
-
-    for(i=2;i<=m/2;i++)
-	*v++ = (2*x)*(*u++) - *t++;  	/* T[i] = 2*x*T[i-1] - T[i-2]	*/
-
-    sum=0.0;                        	/* initialise sum to zero 	*/
-    t = T;                          	/* reset pointer 		*/
-
-    /* Evaluate polynomial and return value also free memory space */
-
-    for(i=0;i<=m/2;i++)
-	sum+=coef[(m/2)-i]**t++;
-
-    return sum;
+    if ((m == LPC_ORD) && (dy == NULL))
+	cheb_eva(y, NULL, coef, x, n, LPC_ORD);
+    else if (m == LPC_ORD)
+	cheb_eva(y, dy, coef, x, n, LPC_ORD);
+    else
+	cheb_eva(y, dy, coef, x, n, m);
 }
 
-
 /*---------------------------------------------------------------------------*\
 
-  FUNCTION....: lpc_to_lsp()
+  FUNCTION....: lsp_polys()
   AUTHOR......: David Rowe
   DATE CREATED: 24/2/93
 
-  This function converts LPC coefficients to LSP coefficients.
+  Determines P'(z)'s and Q'(z)'s coefficients where P'(z) = P(z)/(1 +
+  z^(-1)) and Q'(z) = Q(z)/(1-z^(-1)), in the form cheb_poly_eva()
+  expects.
 
 \*---------------------------------------------------------------------------*/
 
-int lpc_to_lsp (float *a, int lpcrdr, float *freq, int nb, float delta)
-/*  float *a 		     	lpc coefficients			*/
-/*  int lpcrdr			order of LPC coefficients (10) 		*/
-/*  float *freq 	      	LSP frequencies in radians      	*/
-/*  int nb			number of sub-intervals (4) 		*/
-/*  float delta			grid spacing interval (0.02) 		*/
+static void lsp_polys(float *a, int lpcrdr, float *P, float *Q)
 {
-    float psuml,psumr,psumm,temp_xr,xl,xr,xm = 0;
-    float temp_psumr;
-    int i,j,m,flag,k;
+    int i,m;
     float *px;                	/* ptrs of respective P'(z) & Q'(z)	*/
     float *qx;
     float *p;
     float *q;
-    float *pt;                	/* ptr used for cheb_poly_eval()
-				   whether P' or Q' 			*/
-    int roots=0;              	/* number of roots found 	        */
-    float Q[LSP_MAX_ORDER + 1];
-    float P[LSP_MAX_ORDER + 1];
 
-    flag = 1;                	
     m = lpcrdr/2;            	/* order of P'(z) & Q'(z) polynimials 	*/
 
-    /* Allocate memory space for polynomials */
-
-    /* determine P'(z)'s and Q'(z)'s coefficients where
-      P'(z) = P(z)/(1 + z^(-1)) and Q'(z) = Q(z)/(1-z^(-1)) */
-
     px = P;                      /* initilaise ptrs */
     qx = Q;
     p = px;
@@ -179,72 +179,252 @@ int lpc_to_lsp (float *a, int lpcrdr, float *freq, int nb, float delta)
 	 px++;
 	 qx++;
     }
-    px = P;             	/* re-initialise ptrs 			*/
-    qx = Q;
+}
 
-    /* Search for a zero in P'(z) polynomial first and then alternate to Q'(z).
-    Keep alternating between the two polynomials as each zero is found 	*/
+/*---------------------------------------------------------------------------*\
 
-    xr = 0;             	/* initialise xr to zero 		*/
-    xl = 1.0;               	/* start at point xl = 1 		*/
+  FUNCTION....: seed_brackets()
+  DATE CREATED: 19 Oct 2026
 
+  Brackets each root of P'(x) and Q'(x) around last frame's root, from
+  half way to the previous root of the same polynomial to half way to
+  the next.  Returns 1 if every interval has a sign change, that is
+  each holds exactly one of the m roots, else 0 and the caller
+  searches the grid.
 
-    for(j=0;j<lpcrdr;j++){
-	if(j%2)            	/* determines whether P' or Q' is eval. */
-	    pt = qx;
-	else
-	    pt = px;
-
-	psuml = cheb_poly_eva(pt,xl,lpcrdr);	/* evals poly. at xl 	*/
-	flag = 1;
-	while(flag && (xr >= -1.0)){
-	    xr = xl - delta ;                  	/* interval spacing 	*/
-	    psumr = cheb_poly_eva(pt,xr,lpcrdr);/* poly(xl-delta_x) 	*/
-	    temp_psumr = psumr;
-	    temp_xr = xr;
-
-        /* if no sign change increment xr and re-evaluate
-           poly(xr). Repeat til sign change.  if a sign change has
-           occurred the interval is bisected and then checked again
-           for a sign change which determines in which interval the
-           zero lies in.  If there is no sign change between poly(xm)
-           and poly(xl) set interval between xm and xr else set
-           interval between xl and xr and repeat till root is located
-           within the specified limits  */
-
-	    if((psumr*psuml)<0.0){
-		roots++;
-
-		psumm=psuml;
-		for(k=0;k<=nb;k++){
-		    xm = (xl+xr)/2;        	/* bisect the interval 	*/
-		    psumm=cheb_poly_eva(pt,xm,lpcrdr);
-		    if(psumm*psuml>0.){
-			psuml=psumm;
-			xl=xm;
-		    }
-		    else{
-			psumr=psumm;
-			xr=xm;
-		    }
-		}
+\*---------------------------------------------------------------------------*/
+
+static int seed_brackets(float *pq[], int lpcrdr, const float seed[],
+			 float lo[][LSP_MAX_ORDER/2], float flo[][LSP_MAX_ORDER/2],
+			 float hi[][LSP_MAX_ORDER/2], float fhi[][LSP_MAX_ORDER/2])
+{
+    int   i,j,p,m = lpcrdr/2;
+    float x[LSP_MAX_ORDER/2+1],y[LSP_MAX_ORDER/2+1];
+
+    /* seeds must be in order, the first frame and failed frames aren't */
+
+    if ((seed[0] >= 1.0) || (seed[lpcrdr-1] <= -1.0))
+	return 0;
+    for(j=1; j<lpcrdr; j++)
+	if (seed[j] >= seed[j-1])
+	    return 0;
+
+    for(p=0; p<2; p++) {
+	x[0] = 1.0;
+	for(i=1; i<m; i++)
+	    x[i] = 0.5*(seed[2*i + p - 2] + seed[2*i + p]);
+	x[m] = -1.0;
+	cheb_poly_eva(y, NULL, pq[p], x, m+1, lpcrdr);
+	for(i=0; i<m; i++) {
+	    if ((y[i] < 0.0) == (y[i+1] < 0.0))
+		return 0;
+	    hi[p][i] = x[i];   fhi[p][i] = y[i];
+	    lo[p][i] = x[i+1]; flo[p][i] = y[i+1];
+	}
+    }
+
+    return 1;
+}
 
-	       /* once zero is found, reset initial interval to xr 	*/
-	       freq[j] = (xm);
-	       xl = xm;
-	       flag = 0;       		/* reset flag for next search 	*/
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: grid_brackets()
+  DATE CREATED: 19 Oct 2026
+
+  Brackets the roots of P'(x) and Q'(x) by stepping both across a grid
+  of points delta apart from x = 1 down to x = -1, LSP_GRID points at a
+  time.  As in the original search the roots must alternate starting
+  with P', a sign change out of turn is skipped.  Returns the number
+  of roots bracketed, lpcrdr unless the search failed.
+
+\*---------------------------------------------------------------------------*/
+
+static int grid_brackets(float *pq[], int lpcrdr, float delta,
+			 float lo[][LSP_MAX_ORDER/2], float flo[][LSP_MAX_ORDER/2],
+			 float hi[][LSP_MAX_ORDER/2], float fhi[][LSP_MAX_ORDER/2])
+{
+    int   i,k,k0,n,p,m = lpcrdr/2;
+    int   npts = (int)(2.0/delta) + 2;	/* last point at or below -1	*/
+    int   nr[2] = {0, 0};		/* roots bracketed so far	*/
+    int   change[LSP_GRID+1];
+    float x[LSP_GRID+1],y[2][LSP_GRID+1];
+
+    /* element 0 holds the last point of the previous block */
+
+    x[LSP_GRID] = 1.0;
+    cheb_poly_eva(&y[0][LSP_GRID], NULL, pq[0], &x[LSP_GRID], 1, lpcrdr);
+    cheb_poly_eva(&y[1][LSP_GRID], NULL, pq[1], &x[LSP_GRID], 1, lpcrdr);
+    n = LSP_GRID;
+
+    for(k0=1; (k0<npts) && (nr[1]<m); k0+=LSP_GRID) {
+	x[0] = x[n];
+	y[0][0] = y[0][n];
+	y[1][0] = y[1][n];
+	n = (npts - k0 < LSP_GRID) ? npts - k0 : LSP_GRID;
+
+	for(k=1; k<=n; k++)
+	    x[k] = 1.0 - (k0 + k - 1)*delta;
+	cheb_poly_eva(&y[0][1], NULL, pq[0], &x[1], n, lpcrdr);
+	cheb_poly_eva(&y[1][1], NULL, pq[1], &x[1], n, lpcrdr);
+
+	/* sign changes of P' in bit 0 and Q' in bit 1, most points have
+	   neither so find them first in a loop that vectorises */
+
+	for(k=1; k<=n; k++)
+	    change[k] = ((y[0][k-1] < 0.0) != (y[0][k] < 0.0)) |
+		        (((y[1][k-1] < 0.0) != (y[1][k] < 0.0)) << 1);
+
+	for(k=1; k<=n; k++) {
+	    if (!change[k])
+		continue;
+	    for(p=0; p<2; p++) {
+		/* P' root next if we have as many of each, else Q' */
+
+		if (((change[k] >> p) & 1) && (nr[0] - nr[1] == p) && (nr[p] < m)) {
+		    i = nr[p]++;
+		    hi[p][i] = x[k-1]; fhi[p][i] = y[p][k-1];
+		    lo[p][i] = x[k];   flo[p][i] = y[p][k];
+		}
 	    }
-	    else{
-		psuml=temp_psumr;
-		xl=temp_xr;
+	}
+    }
+
+    return nr[0] + nr[1];
+}
+
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: refine_roots()
+  DATE CREATED: 19 Oct 2026
+
+  Narrows the n brackets of the roots of P'(x) and Q'(x) all at once
+  with Newton's method, starting from start[] if given, else the secant
+  through the ends of each bracket.  A step that would leave the bracket bisects it
+  instead, and the bracket is kept up to date with each point tried,
+  so it can't wander off to another root.  Stops once every step is
+  smaller than tol or after LSP_ITER_MAX steps.
+
+  The roots are returned in x[] alternating between P' and Q'.  Roots
+  from neighbouring brackets can still come out in the wrong order, so
+  the count returned stops at the first one that is.
+
+\*---------------------------------------------------------------------------*/
+
+static int refine_roots(float x[], float *pq[], int lpcrdr, int n, float tol,
+			const float start[],
+			float lo[][LSP_MAX_ORDER/2], float flo[][LSP_MAX_ORDER/2],
+			float hi[][LSP_MAX_ORDER/2], float fhi[][LSP_MAX_ORDER/2])
+{
+    int   i,j,k,p,it,done;
+    float r[2][LSP_MAX_ORDER/2],y[LSP_MAX_ORDER/2],dy[LSP_MAX_ORDER/2];
+
+    /* k roots of P', n-k of Q' */
+
+    k = (n + 1)/2;
+    for(p=0; p<2; p++)
+	for(i=0; i<k-p*(n%2); i++)
+	    r[p][i] = start ? start[2*i + p] :
+		(lo[p][i]*fhi[p][i] - hi[p][i]*flo[p][i])/(fhi[p][i] - flo[p][i]);
+
+    for(it=0; it<LSP_ITER_MAX; it++) {
+	done = 1;
+	for(p=0; p<2; p++) {
+	    float *l = lo[p], *fl = flo[p], *h = hi[p], *rp = r[p];
+	    int    np = k - p*(n%2);
+
+	    cheb_poly_eva(y, dy, pq[p], rp, np, lpcrdr);
+
+	    /* written without branches as the side is a coin toss */
+
+	    for(i=0; i<np; i++) {
+		int   low = (y[i] < 0.0) == (fl[i] < 0.0);
+		float xn;
+
+		l[i] = low ? rp[i] : l[i];
+		h[i] = low ? h[i] : rp[i];
+		xn = rp[i] - y[i]/dy[i];
+		xn = ((xn >= l[i]) && (xn <= h[i])) ? xn : 0.5*(l[i] + h[i]);
+		done &= (fabsf(xn - rp[i]) < tol);
+		rp[i] = xn;
 	    }
 	}
+	if (done)
+	    break;
     }
 
+    for(j=0; j<n; j++) {
+	x[j] = r[j%2][j/2];
+	if ((j > 0) && (x[j] >= x[j-1]))
+	    return j;
+    }
+
+    return n;
+}
+
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: lpc_to_lsp()
+  AUTHOR......: David Rowe
+  DATE CREATED: 24/2/93
+
+  This function converts LPC coefficients to LSP coefficients.
+
+  The roots of P'(x) and Q'(x) are first bracketed around last
+  frame's roots if seed[] is given and they still bracket this frame's
+  roots, else by a search of a grid LSP_COARSE*delta apart, else by a
+  search of the delta grid.  Newton's method then narrows all the
+  brackets together until the steps are smaller than bisecting the
+  interval nb+1 times would give.  The roots returned are in
+  decreasing x order and alternate between P' and Q', if they do not
+  the count returned stops at the first one out of order.
+
+\*---------------------------------------------------------------------------*/
+
+int lpc_to_lsp (float *a, int lpcrdr, float *freq, int nb, float delta, float *seed)
+/*  float *a 		     	lpc coefficients			*/
+/*  int lpcrdr			order of LPC coefficients (10) 		*/
+/*  float *freq 	      	LSP frequencies in radians      	*/
+/*  int nb			number of sub-intervals (4) 		*/
+/*  float delta			grid spacing interval (0.02) 		*/
+/*  float *seed			roots in the x domain, last frame's in	*/
+/*				and this frame's out, or NULL		*/
+{
+    int i,n;
+    int roots=0;              	/* number of roots found 	        */
+    float Q[LSP_MAX_ORDER + 1];
+    float P[LSP_MAX_ORDER + 1];
+    float *pq[2] = {P, Q};
+    float lo[2][LSP_MAX_ORDER/2],flo[2][LSP_MAX_ORDER/2];
+    float hi[2][LSP_MAX_ORDER/2],fhi[2][LSP_MAX_ORDER/2];
+    float x[LSP_MAX_ORDER];
+
+    lsp_polys(a, lpcrdr, P, Q);
+
+    /* Bracket the zeros of P'(z) and Q'(z), they alternate starting
+       with P'(z) as we step down from x = 1.  Try around last frame's
+       roots, then a coarse grid that is enough unless roots are close
+       together, then the full grid */
+
+    if ((seed != NULL) && seed_brackets(pq, lpcrdr, seed, lo, flo, hi, fhi))
+	roots = refine_roots(x, pq, lpcrdr, lpcrdr, delta/(2 << nb), seed, lo, flo, hi, fhi);
+    if (roots < lpcrdr) {
+	n = grid_brackets(pq, lpcrdr, LSP_COARSE*delta, lo, flo, hi, fhi);
+	if (n == lpcrdr)
+	    roots = refine_roots(x, pq, lpcrdr, n, delta/(2 << nb), NULL, lo, flo, hi, fhi);
+    }
+    if (roots < lpcrdr) {
+	n = grid_brackets(pq, lpcrdr, delta, lo, flo, hi, fhi);
+	roots = refine_roots(x, pq, lpcrdr, n, delta/(2 << nb), NULL, lo, flo, hi, fhi);
+    }
+
+    if ((seed != NULL) && (roots == lpcrdr))
+	for(i=0; i<lpcrdr; i++)
+	    seed[i] = x[i];
+
     /* convert from x domain to radians */
 
-    for(i=0; i<lpcrdr; i++) {
-	freq[i] = acosf(freq[i]);
+    for(i=0; i<roots; i++) {
+	freq[i] = acosf(x[i]);
     }
 
     return(roots);
@@ -323,3 +503,172 @@ void lsp_to_lpc(float *lsp, float *ak, int lpcrdr)
     }
 }
 
+
+#ifdef LSP_UNITTEST
+
+#include <float.h>
+#include <time.h>
+
+#define ORDER	10
+#define NSETS	20000
+#define DELTA	0.01
+
+/* P'(x) or Q'(x) and its derivative in double precision */
+
+static double cheb_d(float *coef, double x, double *dy)
+{
+    double b0, b1 = 0.0, b2 = 0.0, d0, d1 = 0.0, d2 = 0.0;
+    int    i;
+
+    for(i=0; i<ORDER/2; i++) {
+	d0 = 2*b1 + 2*x*d1 - d2;
+	b0 = coef[i] + 2*x*b1 - b2;
+	d2 = d1; d1 = d0;
+	b2 = b1; b1 = b0;
+    }
+    *dy = b1 + x*d1 - d2;
+
+    return coef[ORDER/2] + x*b1 - b2;
+}
+
+/* root of P'(x) or Q'(x) by bisection on [xr,xl], this ends up at
+   one end if there's no root in between */
+
+static double ref_root(float *coef, double xl, double xr)
+{
+    double xm = 0.0, dy;
+    int    it;
+
+    for(it=0; it<60; it++) {
+	xm = 0.5*(xl + xr);
+	if ((cheb_d(coef, xm, &dy) < 0.0) == (cheb_d(coef, xl, &dy) < 0.0))
+	    xl = xm;
+	else
+	    xr = xm;
+    }
+
+    return xm;
+}
+
+/* random LSPs at least 0.04 rad apart and away from 0 and pi, where
+   the grid is too coarse to split them, or a small step from lsp[] */
+
+static void random_lsps(float lsp[], int walk)
+{
+    int i;
+
+    for(i=0; i<ORDER; i++) {
+	if (walk)
+	    lsp[i] += 0.02*(1.0 - 2.0*rand()/RAND_MAX);
+	else
+	    lsp[i] = 0.3 + (PI - 0.6)*rand()/RAND_MAX;
+    }
+    for(i=1; i<ORDER; i++) {
+	float t = lsp[i];
+	int   j = i;
+	for(; (j > 0) && (lsp[j-1] > t); j--)
+	    lsp[j] = lsp[j-1];
+	lsp[j] = t;
+    }
+    lsp[0] = fmaxf(lsp[0], 0.3);
+    for(i=1; i<ORDER; i++)
+	lsp[i] = fmaxf(lsp[i], lsp[i-1] + 0.04);
+    if (lsp[ORDER-1] > PI - 0.3)
+	random_lsps(lsp, 0);
+}
+
+/* Worst error in x of freq[] against the double precision roots of
+   P'(x) and Q'(x), relative to the bisection's delta/64 plus the error
+   in evaluating the polynomial in float divided by its slope, which
+   is large when roots are close together */
+
+static double root_err(float ak[], float freq[])
+{
+    float  P[ORDER+1], Q[ORDER+1], *c;
+    double err = 0.0, e, x, xr, dy, sum;
+    int    i, j;
+
+    lsp_polys(ak, ORDER, P, Q);
+    for(i=0; i<ORDER; i++) {
+	c = (i%2) ? Q : P;
+	x = cos(freq[i]);
+	xr = ref_root(c, x + 1E-3, x - 1E-3);
+	cheb_d(c, xr, &dy);
+	for(sum=0.0, j=0; j<=ORDER/2; j++)
+	    sum += fabs(c[j]);
+	e = fabs(x - xr)/(DELTA/64 + (ORDER/2 + 1)*(ORDER/2 + 1)*FLT_EPSILON*sum/fabs(dy));
+	err = (e > err) ? e : err;
+    }
+
+    return err;
+}
+
+static double secs(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + 1E-9*t.tv_nsec;
+}
+
+static float ak[NSETS][ORDER+1];
+
+int main(void) {
+    float  lsp[ORDER], freq[ORDER], seed[ORDER], bad[ORDER];
+    float  P[ORDER+1], Q[ORDER+1], *pq[2] = {P, Q};
+    float  lo[2][LSP_MAX_ORDER/2], flo[2][LSP_MAX_ORDER/2];
+    float  hi[2][LSP_MAX_ORDER/2], fhi[2][LSP_MAX_ORDER/2];
+    double err, err_grid = 0.0, err_seed = 0.0, t0, t_grid, t_seed;
+    int    i, j, hits = 0, fails = 0;
+
+    /* a random walk of LSPs like successive frames of speech, each
+       frame both searched from scratch and seeded from the last */
+
+    random_lsps(lsp, 0);
+    for(j=0; j<ORDER; j++)
+	seed[j] = 0.0;
+    for(i=0; i<NSETS; i++) {
+	random_lsps(lsp, (i % 100) != 0);
+	lsp_to_lpc(lsp, ak[i], ORDER);
+
+	lsp_polys(ak[i], ORDER, P, Q);
+	hits += seed_brackets(pq, ORDER, seed, lo, flo, hi, fhi);
+
+	/* seeds in order but from another frame fall back to the grid */
+
+	random_lsps(bad, 0);
+	for(j=0; j<ORDER; j++)
+	    bad[j] = cosf(bad[j]);
+	if ((lpc_to_lsp(ak[i], ORDER, freq, 5, DELTA, bad) != ORDER) ||
+	    (root_err(ak[i], freq) > 1.0))
+	    fails++;
+
+	if (lpc_to_lsp(ak[i], ORDER, freq, 5, DELTA, seed) != ORDER)
+	    fails++;
+	err = root_err(ak[i], freq);
+	err_seed = (err > err_seed) ? err : err_seed;
+
+	if (lpc_to_lsp(ak[i], ORDER, freq, 5, DELTA, NULL) != ORDER)
+	    fails++;
+	err = root_err(ak[i], freq);
+	err_grid = (err > err_grid) ? err : err_grid;
+    }
+    fails += (err_grid > 1.0) + (err_seed > 1.0);
+    printf("grid    max err/bound %5.3f\n", err_grid);
+    printf("seeded  max err/bound %5.3f  seeds used %4.1f%%\n", err_seed, 100.0*hits/NSETS);
+
+    t0 = secs();
+    for(i=0; i<NSETS; i++)
+	lpc_to_lsp(ak[i], ORDER, freq, 5, DELTA, NULL);
+    t_grid = secs() - t0;
+    t0 = secs();
+    for(i=0; i<NSETS; i++)
+	lpc_to_lsp(ak[i], ORDER, freq, 5, DELTA, seed);
+    t_seed = secs() - t0;
+    printf("grid %5.0f ns  seeded %5.0f ns\n", 1E9*t_grid/NSETS, 1E9*t_seed/NSETS);
+
+    printf("%s\n", fails ? "FAIL" : "PASS");
+    return fails;
+}
+
+#endif
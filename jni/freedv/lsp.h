@@ -31,7 +31,7 @@
 #ifndef __LSP__
 #define __LSP__
 
-int lpc_to_lsp (float *a, int lpcrdr, float *freq, int nb, float delta);
+int lpc_to_lsp (float *a, int lpcrdr, float *freq, int nb, float delta, float *seed);
 void lsp_to_lpc(float *freq, float *ak, int lpcrdr);
 
 #endif
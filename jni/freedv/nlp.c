@@ -29,14 +29,12 @@
 #include "nlp.h"
 #include "dump.h"
 #include "kiss_fft.h"
+#include "kernels.h"
 
 #include <assert.h>
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
-#if defined(__ARM_NEON__)
-#include <arm_neon.h>
-#endif
 
 /*---------------------------------------------------------------------------*\
                                                                              
@@ -54,6 +52,9 @@
 #define F0_MAX      500
 #define CNLP        0.3	        /* post processor constant              */
 #define NLP_NTAP 48	        /* Decimation LPF order */
+#define SUB_FFT     64          /* pruned DFT sub-transform size        */
+#define NSUB        (PE_FFT_SIZE/2/SUB_FFT) /* number of sub-transforms */
+#define TOL_NLP_DFT 1E-4        /* check mode tolerance, pruned DFT     */
 
 /*---------------------------------------------------------------------------*\
                                                                             
@@ -117,8 +118,14 @@ const float nlp_fir[] = {
 typedef struct {
     float         sq[PMAX_M];	     /* squared speech samples       */
     float         mem_x,mem_y;       /* memory for notch filter      */
-    float         mem_fir[NLP_NTAP]; /* decimation FIR filter memory */
+    float         fir_buf[NLP_NTAP-1+PMAX_M]; /* decimation FIR filter
+						 memory then input block */
     kiss_fft_cfg  fft_cfg;           /* kiss FFT config              */
+    kiss_fft_cfg  sub_cfg;           /* SUB_FFT point config         */
+    float         w[PMAX_M/DEC];     /* window for decimated samples */
+    int           nw;                /* window length w[] is for     */
+    COMP          tw_sub[NSUB][SUB_FFT]; /* W(PE_FFT_SIZE/2)^(n*r)    */
+    COMP          tw_split[PE_FFT_SIZE/2+1]; /* W(PE_FFT_SIZE)^k       */
 } NLP;
 
 float test_candidate_mbe(COMP Sw[], COMP W[], float f0);
@@ -138,27 +145,37 @@ float post_process_sub_multiples(COMP Fw[],
 void *nlp_create()
 {
     NLP *nlp;
-    int  i;
+    int  i, r;
 
     nlp = (NLP*)malloc(sizeof(NLP));
     if (nlp == NULL)
     return NULL;
-#if !defined(__ARM_NEON__)
+    kernels_init();
+
     for(i=0; i<PMAX_M; i++)
         nlp->sq[i] = 0.0;
-#else
-    float32x4_t zerovec = { 0.0f, 0.0f, 0.0f, 0.0f };
-    for(i=0; i<PMAX_M; i+=4) {
-        vst1q_f32(&nlp->sq[i], zerovec);
-    }
-#endif
     nlp->mem_x = 0.0;
     nlp->mem_y = 0.0;
-    for(i=0; i<NLP_NTAP; i++)
-        nlp->mem_fir[i] = 0.0;
+    for(i=0; i<NLP_NTAP-1; i++)
+        nlp->fir_buf[i] = 0.0;
 
     nlp->fft_cfg = kiss_fft_alloc (PE_FFT_SIZE, 0, NULL, NULL);
     assert(nlp->fft_cfg != NULL);
+    nlp->sub_cfg = kiss_fft_alloc (SUB_FFT, 0, NULL, NULL);
+    assert(nlp->sub_cfg != NULL);
+
+    /* twiddles for the pruned DFT, see nlp_dft() */
+
+    nlp->nw = 0;
+    for(r=0; r<NSUB; r++)
+	for(i=0; i<SUB_FFT; i++) {
+	    nlp->tw_sub[r][i].real = cos(2.0*PI*r*i/(PE_FFT_SIZE/2));
+	    nlp->tw_sub[r][i].imag = -sin(2.0*PI*r*i/(PE_FFT_SIZE/2));
+	}
+    for(i=0; i<=PE_FFT_SIZE/2; i++) {
+	nlp->tw_split[i].real = cos(2.0*PI*i/PE_FFT_SIZE);
+	nlp->tw_split[i].imag = -sin(2.0*PI*i/PE_FFT_SIZE);
+    }
 
     return (void*)nlp;
 }
@@ -178,9 +195,87 @@ void nlp_destroy(void *nlp_state)
     nlp = (NLP*)nlp_state;
 
     KISS_FFT_FREE(nlp->fft_cfg);
+    KISS_FFT_FREE(nlp->sub_cfg);
     free(nlp_state);
 }
 
+/*---------------------------------------------------------------------------*\
+                                                                             
+  nlp_dft()
+                                                                             
+  |DFT|^2 of the nw real samples dec[], zero padded to PE_FFT_SIZE,
+  for bins lo..hi only, returned in Fw[lo..hi].real.  The other bins of
+  Fw[] are not written.
+
+  The input is real and at most PMAX_M/DEC samples long, so it is
+  packed two samples per complex value into z[], which has at most
+  SUB_FFT non zero values out of PE_FFT_SIZE/2.  Bin k = NSUB*q + r of
+  Z = DFT(z) is then bin q of a SUB_FFT point DFT of z[n]*W^(n*r), so
+  Z takes NSUB short FFTs rather than one PE_FFT_SIZE point FFT.  The
+  usual real FFT split recovers the bins of the real signal from Z[k]
+  and Z[PE_FFT_SIZE/2-k].
+
+\*---------------------------------------------------------------------------*/
+
+static void nlp_dft(NLP *nlp, COMP Fw[], const float dec[], int nw, int lo, int hi)
+{
+    COMP  z[SUB_FFT], zt[SUB_FFT];
+    COMP  Z[NSUB][SUB_FFT];          /* bin k is Z[k%NSUB][k/NSUB]    */
+    COMP  a, b, fe, fo, t;
+    float re, im;
+    int   i, r, k, nk;
+
+    assert(nw <= 2*SUB_FFT);
+    assert((lo >= 0) && (hi < PE_FFT_SIZE/2));
+
+    for(i=0; i<SUB_FFT; i++) {
+	z[i].real = (2*i < nw) ? dec[2*i] : 0.0;
+	z[i].imag = (2*i+1 < nw) ? dec[2*i+1] : 0.0;
+    }
+    kiss_fft(nlp->sub_cfg, (kiss_fft_cpx *)z, (kiss_fft_cpx *)Z[0]);
+    for(r=1; r<NSUB; r++) {
+	for(i=0; i<SUB_FFT; i++) {
+	    t = nlp->tw_sub[r][i];
+	    zt[i].real = z[i].real*t.real - z[i].imag*t.imag;
+	    zt[i].imag = z[i].real*t.imag + z[i].imag*t.real;
+	}
+	kiss_fft(nlp->sub_cfg, (kiss_fft_cpx *)zt, (kiss_fft_cpx *)Z[r]);
+    }
+
+    /* X[k] = Fe[k] + W^k Fo[k] with Fe, Fo the DFTs of the even and
+       odd samples */
+
+    for(k=lo; k<=hi; k++) {
+	nk = (PE_FFT_SIZE/2 - k) % (PE_FFT_SIZE/2);
+	a = Z[k%NSUB][k/NSUB];
+	b = Z[nk%NSUB][nk/NSUB];
+	fe.real = 0.5*(a.real + b.real);
+	fe.imag = 0.5*(a.imag - b.imag);
+	fo.real = 0.5*(a.imag + b.imag);  /* -j(a - conj(b))/2 */
+	fo.imag = -0.5*(a.real - b.real);
+	t = nlp->tw_split[k];
+	re = fe.real + fo.real*t.real - fo.imag*t.imag;
+	im = fe.imag + fo.real*t.imag + fo.imag*t.real;
+	Fw[k].real = re*re + im*im;
+    }
+}
+
+/* reference version of nlp_dft(), all bins with a full FFT, for
+   DUMP and check mode */
+
+static void nlp_dft_full(NLP *nlp, COMP Fw[], const float dec[], int nw)
+{
+    COMP fw[PE_FFT_SIZE];
+    int  i;
+
+    init_comp_array(fw, PE_FFT_SIZE);
+    for(i=0; i<nw; i++)
+	fw[i].real = dec[i];
+    kiss_fft(nlp->fft_cfg, (kiss_fft_cpx *)fw, (kiss_fft_cpx *)Fw);
+    for(i=0; i<PE_FFT_SIZE; i++)
+	Fw[i].real = Fw[i].real*Fw[i].real + Fw[i].imag*Fw[i].imag;
+}
+
 /*---------------------------------------------------------------------------*\
                                                                              
   nlp()                                                                  
@@ -226,11 +321,11 @@ float nlp(
 {
     NLP   *nlp;
     float  notch;		    /* current notch filter output    */
-    COMP   fw[PE_FFT_SIZE];	    /* DFT of squared signal (input)  */
+    float  dec[PMAX_M/DEC];	    /* decimated, windowed signal     */
     COMP   Fw[PE_FFT_SIZE];	    /* DFT of squared signal (output) */
     float  gmax;
     int    gmax_bin;
-    int   i,j;
+    int   i, start, step, lo, hi;
     float best_f0;
 
     assert(nlp_state != NULL);
@@ -238,16 +333,8 @@ float nlp(
     nlp = (NLP*)nlp_state;
 
      /* Square, notch filter at DC, and LP filter vector */
-#if !defined(__ARM_NEON__)
     for(i=m-n; i<m; i++)       /* square latest speech samples */
        nlp->sq[i] = Sn[i]*Sn[i];
-#else
-    for(i=m-n; i<m; i+=4) {  // m and n should %4 = 0
-       float32x4_t sq4 = vld1q_f32(&Sn[i]);
-       sq4 = vmulq_f32(sq4, sq4);
-       vst1q_f32(&nlp->sq[i], sq4);
-     }
-#endif
     float mem_x = nlp->mem_x, mem_y = nlp->mem_y;
     for(i=m-n; i<m; i++) {    /* notch filter at DC */
         notch = nlp->sq[i] - mem_x;
@@ -266,45 +353,59 @@ float nlp(
     nlp->mem_x = mem_x;
     nlp->mem_y = mem_y;
  
-    for(i=m-n; i<m; i++) {    /* FIR filter vector */
-        memmove(&nlp->mem_fir[0], &nlp->mem_fir[1], (NLP_NTAP-1) * sizeof(float));
-        nlp->mem_fir[NLP_NTAP-1] = nlp->sq[i];
-
-#if !defined(__ARM_NEON__)
-       float tmpsum = 0.0f;
-       for(j=0; j<NLP_NTAP; j++) {
-           tmpsum += nlp->mem_fir[j]*nlp_fir[j];
-       }
-       nlp->sq[i] = tmpsum;
-#else
-       float32x4_t sum4 = { 0.0f, 0.0f, 0.0f, 0.0f };
-       for(j=0; j<NLP_NTAP; j+=4) {  // NLP_NTAP should %4 = 0
-               float32x4_t mem_fir4 = vld1q_f32(&nlp->mem_fir[j]);
-               float32x4_t nlp_fir4 = vld1q_f32(&nlp_fir[j]);
-               sum4 = vmlaq_f32(sum4, mem_fir4, nlp_fir4);
-       }
-       nlp->sq[i] = vgetq_lane_f32(sum4, 0) + vgetq_lane_f32(sum4, 1) +
-               vgetq_lane_f32(sum4, 2) + vgetq_lane_f32(sum4, 3);
-#endif
-     }
-        /* Decimate and DFT */
-    init_comp_array(fw, PE_FFT_SIZE);
-     for(i=0; i<m/DEC; i++) {
-       fw[i].real = nlp->sq[i*DEC]*(0.5 - 0.5*cosf(2*PI*i/(m/DEC-1)));
-     }
+    /* FIR filter vector.  fir_buf[] holds the last NLP_NTAP-1 notch
+       filter outputs followed by this block, so the output for sq[i]
+       is a dot product starting at fir_buf[i-(m-n)].  We only filter
+       the samples that survive decimation, the rest of sq[] keeps the
+       unfiltered values and is never read.  That needs n to be a
+       multiple of DEC so the filtered samples stay on the decimation
+       grid when sq[] is shifted at the end. */
+
+    memcpy(&nlp->fir_buf[NLP_NTAP-1], &nlp->sq[m-n], n*sizeof(float));
+    step = (n % DEC) ? 1 : DEC;
 #ifdef DUMP
-       dump_dec(Fw);
+    step = 1;                 /* dump_sq() wants every sample */
 #endif
- 
-    kiss_fft(nlp->fft_cfg, (kiss_fft_cpx *)fw, (kiss_fft_cpx *)Fw);
-    for(i=0; i<PE_FFT_SIZE; i++) {
-        Fw[i].real = Fw[i].real*Fw[i].real + Fw[i].imag*Fw[i].imag;
+    start = ((m-n + step-1)/step)*step;
+    for(i=start; i<m; i+=step)
+        nlp->sq[i] = kernels->dot(&nlp->fir_buf[i-(m-n)], nlp_fir, NLP_NTAP);
+    memmove(&nlp->fir_buf[0], &nlp->fir_buf[n], (NLP_NTAP-1)*sizeof(float));
+
+    /* Decimate, window and DFT.  Only Fw[] bins from just below
+       PE_FFT_SIZE*DEC/pmax to just above PE_FFT_SIZE*DEC/pmin are read
+       by the peak search and post processor. */
+
+    if (nlp->nw != m/DEC) {
+	nlp->nw = m/DEC;
+	for(i=0; i<m/DEC; i++)
+	    nlp->w[i] = 0.5 - 0.5*cosf(2*PI*i/(m/DEC-1));
     }
+    for(i=0; i<m/DEC; i++)
+	dec[i] = nlp->sq[i*DEC]*nlp->w[i];
+    lo = PE_FFT_SIZE*DEC/pmax - 1;
+    hi = PE_FFT_SIZE*DEC/pmin + 1;
 
-    #ifdef DUMP
+#ifdef DUMP
+    for(i=0; i<m/DEC; i++)
+	Fw[i].real = dec[i];
+    dump_dec(Fw);
+    nlp_dft_full(nlp, Fw, dec, m/DEC);
     dump_sq(nlp->sq);
     dump_Fw(Fw);
-    #endif
+#else
+    nlp_dft(nlp, Fw, dec, m/DEC, lo, hi);
+    if (kernels_checking()) {
+	COMP  ref[PE_FFT_SIZE];
+	float mag_ref[PE_FFT_SIZE], mag[PE_FFT_SIZE];
+
+	nlp_dft_full(nlp, ref, dec, m/DEC);
+	for(i=lo; i<=hi; i++) {
+	    mag_ref[i] = ref[i].real;
+	    mag[i] = Fw[i].real;
+	}
+	kernels_check_float("nlp_dft", &mag_ref[lo], &mag[lo], hi-lo+1, TOL_NLP_DFT);
+    }
+#endif
 
     /* find global peak */
 
@@ -29,6 +29,7 @@
 #include "phase.h"
 #include "kiss_fft.h"
 #include "comp.h"
+#include "vmath.h"
 #include "glottal.c"
 
 #include <assert.h>
@@ -65,7 +66,7 @@ void aks_to_H(
   float Em;		/* energy in band */
   float Am;		/* spectral amplitude sample */
   int   b;		/* centre bin of harmonic */
-  float phi_;		/* phase of LPC spectra */
+  float mag;		/* magnitude of A(exp(jw)) at b */
 
   r = TWO_PI/(FFT_ENC);
 
@@ -90,9 +91,18 @@ void aks_to_H(
       Em += G/(Pw[i].real*Pw[i].real + Pw[i].imag*Pw[i].imag);
     Am = sqrtf(fabsf(Em/(bm-am)));
 
-    phi_ = -atan2f(Pw[b].imag,Pw[b].real);
-    H[m].real = Am*cosf(phi_);
-    H[m].imag = Am*sinf(phi_);
+    /* phase of the synthesis filter 1/A is -arg(A), so H[m] is Am in
+       the direction of conj(Pw[b]), no trig functions needed */
+
+    mag = sqrtf(Pw[b].real*Pw[b].real + Pw[b].imag*Pw[b].imag);
+    if (mag > 0.0) {
+	H[m].real =  Am*Pw[b].real/mag;
+	H[m].imag = -Am*Pw[b].imag/mag;
+    }
+    else {
+	H[m].real = Am;
+	H[m].imag = 0.0;
+    }
   }
 }
 
@@ -192,13 +202,17 @@ void phase_synth_zero_order(
     MODEL *model,
     float  aks[],
     float *ex_phase,            /* excitation phase of fundamental */
-    int    order
+    int    order,
+    struct PRNG *prng           /* random phases of unvoiced frames */
 )
 {
   int   m;
-  float new_phi;
-  COMP  Ex[MAX_AMP+1];		/* excitation samples */
-  COMP  A_[MAX_AMP+1];		/* synthesised harmonic samples */
+  float phi[MAX_AMP+1];		/* excitation phases */
+  float u[MAX_AMP+1];		/* uniform random numbers */
+  float Ex_re[MAX_AMP+1];	/* excitation samples */
+  float Ex_im[MAX_AMP+1];
+  float A_re[MAX_AMP+1];	/* synthesised harmonic samples */
+  float A_im[MAX_AMP+1];
   COMP  H[MAX_AMP+1];           /* LPC freq domain samples */
   float G;
   float jitter = 0.0;
@@ -220,10 +234,12 @@ void phase_synth_zero_order(
   ex_phase[0] += (model->Wo)*N;
   ex_phase[0] -= TWO_PI*floorf(ex_phase[0]/TWO_PI + 0.5);
   r = TWO_PI/GLOTTAL_FFT_SIZE;
+  if (!model->voiced)
+      prng_uniform(prng, &u[1], model->L);
 
   for(m=1; m<=model->L; m++) {
       
-    /* generate excitation */
+    /* generate excitation phases */
 	    
     if (model->voiced) {
 	//float rnd;
@@ -241,8 +257,7 @@ void phase_synth_zero_order(
 	jitter = 0;
 
 	//rnd = (PI/8)*(1.0 - 2.0*rand()/RAND_MAX);
-	Ex[m].real = cosf(ex_phase[0]*m/* - jitter*model->Wo*m + glottal[b]*/);
-	Ex[m].imag = sinf(ex_phase[0]*m/* - jitter*model->Wo*m + glottal[b]*/);
+	phi[m] = ex_phase[0]*m/* - jitter*model->Wo*m + glottal[b]*/;
     }
     else {
 
@@ -250,21 +265,21 @@ void phase_synth_zero_order(
 	   phase is not needed in the unvoiced case, but no harm in
 	   keeping it.
         */
-	float phi = TWO_PI*(float)rand()/RAND_MAX;
-        Ex[m].real = cosf(phi);
-	Ex[m].imag = sinf(phi);
+	phi[m] = TWO_PI*u[m];
     }
+  }
+  vsincosf(&Ex_im[1], &Ex_re[1], &phi[1], model->L);
 
-    /* filter using LPC filter */
+  /* filter using LPC filter */
 
-    A_[m].real = H[m].real*Ex[m].real - H[m].imag*Ex[m].imag;
-    A_[m].imag = H[m].imag*Ex[m].real + H[m].real*Ex[m].imag;
+  for(m=1; m<=model->L; m++) {
+    A_re[m] = H[m].real*Ex_re[m] - H[m].imag*Ex_im[m] + 1E-12;
+    A_im[m] = H[m].imag*Ex_re[m] + H[m].real*Ex_im[m];
+  }
 
-    /* modify sinusoidal phase */
+  /* modify sinusoidal phase */
    
-    new_phi = atan2f(A_[m].imag, A_[m].real+1E-12);
-    model->phi[m] = new_phi;
-  }
+  vatan2f(&model->phi[1], &A_im[1], &A_re[1], model->L);
 
 }
 
@@ -29,11 +29,13 @@
 #define __PHASE__
 
 #include "kiss_fft.h"
+#include "prng.h"
 
 void phase_synth_zero_order(kiss_fft_cfg fft_dec_cfg, 
 			    MODEL *model, 
 			    float aks[], 
                             float *ex_phase, 
-			    int order);
+			    int order,
+			    struct PRNG *prng);
 
 #endif
@@ -0,0 +1,49 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: pitch.h
+  DATE CREATED: 19 Oct 2026
+
+  Pluggable pitch estimators for the Codec 2 encoder.  Each engine
+  keeps its own state and has the same calling convention as nlp(),
+  see codec2_set_pitch_engine().
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __PITCH__
+#define __PITCH__
+
+#include "comp.h"
+
+struct PITCH_ENGINE {
+    const char *name;
+    void *(*create)(void);
+    void  (*destroy)(void *state);
+
+    /* Sn[] is the last m input samples, n of them new since the last
+       call.  Returns F0 in Hz and the pitch period in samples in
+       *pitch.  Sw[], W[] and prev_Wo are hints an engine may use. */
+
+    float (*estimate)(void *state, float Sn[], int n, int m, int pmin, int pmax,
+		      float *pitch, COMP Sw[], COMP W[], float *prev_Wo);
+};
+
+/* engine number is one of CODEC2_PITCH_XXX, NULL if unknown */
+
+const struct PITCH_ENGINE *pitch_engine(int engine);
+
+#endif
@@ -36,6 +36,7 @@
 #include "comp.h"
 #include "dump.h"
 #include "postfilter.h"
+#include "vmath.h"
 
 /*---------------------------------------------------------------------------*\
 
@@ -99,11 +100,13 @@
 
 void postfilter(
   MODEL *model,
-  float *bg_est
+  float *bg_est,
+  struct PRNG *prng
 )	
 {
   int   m, uv;
-  float e;
+  float e, thresh;
+  float u[MAX_AMP+1];
 
   /* determine average energy across spectrum */
 
@@ -112,7 +115,9 @@ void postfilter(
       e += model->A[m]*model->A[m];
 
   assert(e > 0.0);
-  e = 10.0*log10f(e/model->L);
+  e = e/model->L;
+  vlog10f(&e, &e, 1);
+  e = 10.0*e;
 
   /* If beneath threhold, update bg estimate.  The idea
      of the threshold is to prevent updating during high level
@@ -126,12 +131,20 @@ void postfilter(
   */
 
   uv = 0;
-  if (model->voiced)
+  if (model->voiced) {
+
+      /* compare amplitudes with the threshold in the linear domain,
+	 rather than taking the log of every harmonic */
+
+      thresh = (*bg_est + BG_MARGIN)/20.0;
+      vexp10f(&thresh, &thresh, 1);
+      prng_uniform(prng, &u[1], model->L);
       for(m=1; m<=model->L; m++)
-	  if (20.0*log10f(model->A[m]) < (*bg_est + BG_MARGIN)) {
-	      model->phi[m] = TWO_PI*(float)rand()/RAND_MAX;
+	  if (model->A[m] < thresh) {
+	      model->phi[m] = TWO_PI*u[m];
 	      uv++;
 	  }
+  }
 
 #ifdef DUMP
   dump_bg(e, *bg_est, 100.0*uv/model->L);
@@ -28,6 +28,8 @@
 #ifndef __POSTFILTER__
 #define __POSTFILTER__
 
-void postfilter(MODEL *model, float *bg_est);
+#include "prng.h"
+
+void postfilter(MODEL *model, float *bg_est, struct PRNG *prng);
 
 #endif
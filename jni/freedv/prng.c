@@ -0,0 +1,113 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: prng.c
+  DATE CREATED: 19 Oct 2026
+
+  PRNG_LANES interleaved xorshift32 generators [1].  Output i comes
+  from lane i % PRNG_LANES, so a block of outputs is one step of every
+  lane and the loop vectorises.  Each lane has a period of 2^32-1,
+  plenty for random phases and noise, but this is not meant for
+  anything needing statistical quality beyond that.
+
+  The sequence depends only on the seed and the lengths of the
+  prng_uniform() calls, so runs are reproducible.
+
+  References:
+
+    [1] G. Marsaglia, "Xorshift RNGs", Journal of Statistical
+        Software 8(14), 2003.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "prng.h"
+
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: prng_seed()
+  DATE CREATED: 19 Oct 2026
+
+  Sets the lanes from seed.  Any seed is fine, including 0, the lanes
+  are scrambled so nearby seeds give unrelated sequences.
+
+\*---------------------------------------------------------------------------*/
+
+void prng_seed(struct PRNG *prng, uint32_t seed)
+{
+    uint32_t z;
+    int      l;
+
+    assert(prng != NULL);
+    for(l=0; l<PRNG_LANES; l++) {
+
+	/* splitmix32 style finaliser of seed and lane */
+
+	z = seed + 0x9e3779b9u*(uint32_t)(l + 1);
+	z = (z ^ (z >> 16))*0x85ebca6bu;
+	z = (z ^ (z >> 13))*0xc2b2ae35u;
+	z = z ^ (z >> 16);
+	prng->s[l] = z ? z : 0x6d2b79f5u;
+    }
+}
+
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: prng_uniform()
+  DATE CREATED: 19 Oct 2026
+
+  n values uniformly distributed in [0,1), with 24 bit resolution.
+
+\*---------------------------------------------------------------------------*/
+
+void prng_uniform(struct PRNG *prng, float x[], int n)
+{
+    uint32_t s[PRNG_LANES];
+    float    block[PRNG_LANES];
+    int      i, l;
+
+    assert(prng != NULL);
+    for(l=0; l<PRNG_LANES; l++)
+	s[l] = prng->s[l];
+
+    for(i=0; i+PRNG_LANES<=n; i+=PRNG_LANES) {
+	for(l=0; l<PRNG_LANES; l++) {
+	    s[l] ^= s[l] << 13;
+	    s[l] ^= s[l] >> 17;
+	    s[l] ^= s[l] << 5;
+	    x[i+l] = (float)(int32_t)(s[l] >> 8)*(1.0f/16777216.0f);
+	}
+    }
+
+    /* a short last block still steps every lane */
+
+    if (i < n) {
+	for(l=0; l<PRNG_LANES; l++) {
+	    s[l] ^= s[l] << 13;
+	    s[l] ^= s[l] >> 17;
+	    s[l] ^= s[l] << 5;
+	    block[l] = (float)(int32_t)(s[l] >> 8)*(1.0f/16777216.0f);
+	}
+	for(l=0; i<n; l++, i++)
+	    x[i] = block[l];
+    }
+
+    for(l=0; l<PRNG_LANES; l++)
+	prng->s[l] = s[l];
+}
@@ -0,0 +1,41 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: prng.h
+  DATE CREATED: 19 Oct 2026
+
+  Small seedable pseudo random number generator, one per codec
+  instance, so decoders on different threads do not share the C
+  library rand() state.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __PRNG__
+#define __PRNG__
+
+#include <stdint.h>
+
+#define PRNG_LANES 8            /* independent generators, one per vector lane */
+
+struct PRNG {
+    uint32_t s[PRNG_LANES];     /* xorshift32 states, never 0 */
+};
+
+void prng_seed(struct PRNG *prng, uint32_t seed);
+void prng_uniform(struct PRNG *prng, float x[], int n);
+
+#endif
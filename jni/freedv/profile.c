@@ -0,0 +1,170 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: profile.c
+  DATE CREATED: 19 Oct 2026
+
+  Per-stage timing counters, see profile.h.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "profile.h"
+
+static const char *stage_names[PROFILE_NUM_STAGES] = {
+    "rx_est_freq_offset",
+    "fdmdv_freq_shift",
+    "fdm_downconvert",
+    "rx_filter",
+    "rx_est_timing",
+    "qpsk_to_bits",
+    "snr_update",
+    "fdmdv_get_rx_spectrum",
+    "unpack",
+    "decode_WoE",
+    "lsp_decode",
+    "aks_to_M2",
+    "phase_synth_zero_order",
+    "postfilter",
+    "synthesise"
+};
+
+#ifdef PROFILE
+
+struct PROFILE_STAGE {
+    unsigned int  ns[PROFILE_WINDOW]; /* ring of recent call durations */
+    unsigned int  next;               /* next slot to write in ns[]    */
+    unsigned long count;
+    unsigned int  worst_ns;
+};
+
+static struct PROFILE_STAGE stages[PROFILE_NUM_STAGES];
+
+profile_t profile_sample(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (profile_t)ts.tv_sec*1000000000ULL + ts.tv_nsec;
+}
+
+profile_t profile_sample_and_log(profile_t start, int stage)
+{
+    struct PROFILE_STAGE *s;
+    profile_t             now;
+    unsigned int          ns;
+
+    assert((stage >= 0) && (stage < PROFILE_NUM_STAGES));
+    now = profile_sample();
+    ns = (now - start) > 0xffffffffULL ? 0xffffffff : (unsigned int)(now - start);
+
+    s = &stages[stage];
+    s->ns[s->next] = ns;
+    s->next = (s->next + 1) % PROFILE_WINDOW;
+    s->count++;
+    if (ns > s->worst_ns)
+	s->worst_ns = ns;
+
+    /* restart the clock so the overhead of logging is not charged to
+       the next stage */
+
+    return profile_sample();
+}
+
+static int cmp_uint(const void *a, const void *b)
+{
+    unsigned int x = *(const unsigned int *)a;
+    unsigned int y = *(const unsigned int *)b;
+
+    return (x > y) - (x < y);
+}
+
+#endif
+
+int CODEC2_WIN32SUPPORT profile_enabled(void)
+{
+#ifdef PROFILE
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+const char * CODEC2_WIN32SUPPORT profile_stage_name(int stage)
+{
+    assert((stage >= 0) && (stage < PROFILE_NUM_STAGES));
+    return stage_names[stage];
+}
+
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: profile_get_stats()
+  DATE CREATED: 19 Oct 2026
+
+  Summarises the last PROFILE_WINDOW calls of one stage.  All zeros if
+  the stage has not run yet, or if built without -DPROFILE.
+
+\*---------------------------------------------------------------------------*/
+
+void CODEC2_WIN32SUPPORT profile_get_stats(int stage, struct PROFILE_STATS *stats)
+{
+#ifdef PROFILE
+    struct PROFILE_STAGE *s;
+    unsigned int          sorted[PROFILE_WINDOW];
+    unsigned long         count;
+    double                sum;
+    int                   i, n;
+#endif
+
+    assert((stage >= 0) && (stage < PROFILE_NUM_STAGES));
+    memset(stats, 0, sizeof(struct PROFILE_STATS));
+
+#ifdef PROFILE
+    s = &stages[stage];
+    count = s->count;
+    if (count == 0)
+	return;
+    n = count < PROFILE_WINDOW ? count : PROFILE_WINDOW;
+
+    /* until the ring wraps the valid samples are ns[0..n-1] */
+
+    memcpy(sorted, s->ns, sizeof(unsigned int)*n);
+    qsort(sorted, n, sizeof(unsigned int), cmp_uint);
+
+    sum = 0.0;
+    for(i=0; i<n; i++)
+	sum += sorted[i];
+
+    stats->count    = count;
+    stats->mean_us  = 1E-3*sum/n;
+    stats->p50_us   = 1E-3*sorted[n/2];
+    stats->p99_us   = 1E-3*sorted[(99*(n-1))/100];
+    stats->max_us   = 1E-3*sorted[n-1];
+    stats->worst_us = 1E-3*s->worst_ns;
+#endif
+}
+
+void CODEC2_WIN32SUPPORT profile_reset(void)
+{
+#ifdef PROFILE
+    memset(stages, 0, sizeof(stages));
+#endif
+}
@@ -0,0 +1,113 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: profile.h
+  DATE CREATED: 19 Oct 2026
+
+  Optional per-stage timing counters for the modem and speech decoder.
+
+  Build with -DPROFILE to enable.  Without it the PROFILE_* macros
+  expand to nothing so the instrumented code is unchanged, and the
+  read API below just reports empty stats.
+
+  Usage in a function to be profiled:
+
+    PROFILE_VAR(t);
+    PROFILE_SAMPLE(t);
+    stage_one();
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_STAGE_ONE);
+    stage_two();
+    PROFILE_SAMPLE_AND_LOG(t, PROFILE_STAGE_TWO);
+
+  Each stage keeps the last PROFILE_WINDOW call durations, from which
+  profile_get_stats() works out p50/p99/max.  The counters are global
+  and are meant to be written by a single (audio) thread; a reader on
+  another thread may see a partially updated window, which is fine
+  for diagnostics.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __PROFILE__
+#define __PROFILE__
+
+#include "codec2_fdmdv.h"        /* CODEC2_WIN32SUPPORT */
+
+#define PROFILE_WINDOW 256       /* call durations kept per stage      */
+
+/* stages we keep timing for */
+
+enum {
+    /* fdmdv_demod() */
+
+    PROFILE_RX_EST_FREQ_OFFSET,
+    PROFILE_FDMDV_FREQ_SHIFT,
+    PROFILE_FDM_DOWNCONVERT,
+    PROFILE_RX_FILTER,
+    PROFILE_RX_EST_TIMING,
+    PROFILE_QPSK_TO_BITS,
+    PROFILE_SNR_UPDATE,
+    PROFILE_FDMDV_GET_RX_SPECTRUM,
+
+    /* codec2_decode() */
+
+    PROFILE_UNPACK,
+    PROFILE_DECODE_WOE,
+    PROFILE_LSP_DECODE,
+    PROFILE_AKS_TO_M2,
+    PROFILE_PHASE_SYNTH_ZERO_ORDER,
+    PROFILE_POSTFILTER,
+    PROFILE_SYNTHESISE,
+
+    PROFILE_NUM_STAGES
+};
+
+struct PROFILE_STATS {
+    unsigned long count;         /* calls since last reset             */
+    float         mean_us;       /* over the last PROFILE_WINDOW calls */
+    float         p50_us;
+    float         p99_us;
+    float         max_us;
+    float         worst_us;      /* largest since last reset           */
+};
+
+#ifdef PROFILE
+
+typedef unsigned long long profile_t;
+
+#define PROFILE_VAR(...)               profile_t __VA_ARGS__
+#define PROFILE_SAMPLE(t)              t = profile_sample()
+#define PROFILE_SAMPLE_AND_LOG(t, stage) t = profile_sample_and_log(t, stage)
+
+profile_t profile_sample(void);
+profile_t profile_sample_and_log(profile_t start, int stage);
+
+#else
+
+#define PROFILE_VAR(...)
+#define PROFILE_SAMPLE(t)
+#define PROFILE_SAMPLE_AND_LOG(t, stage)
+
+#endif
+
+/* read API, always present so callers need not care about -DPROFILE */
+
+int  CODEC2_WIN32SUPPORT profile_enabled(void);
+const char * CODEC2_WIN32SUPPORT profile_stage_name(int stage);
+void CODEC2_WIN32SUPPORT profile_get_stats(int stage, struct PROFILE_STATS *stats);
+void CODEC2_WIN32SUPPORT profile_reset(void);
+
+#endif
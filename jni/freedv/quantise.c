@@ -37,6 +37,8 @@
 #include "lpc.h"
 #include "lsp.h"
 #include "kiss_fft.h"
+#include "kernels.h"
+#include "vmath.h"
 
 #define LSP_DELTA1 0.01         /* grid spacing for LSP root searches */
 
@@ -47,7 +49,7 @@
 \*---------------------------------------------------------------------------*/
 
 float speech_to_uq_lsps(float lsp[], float ak[], float Sn[], float w[], 
-			int order);
+			int order, float lsp_x[]);
 
 /*---------------------------------------------------------------------------*\
 									      
@@ -102,26 +104,18 @@ long quantise(const float * cb, float vec[], float w[], int k, int m, float *se)
 /* int     m;		size of codebook		*/
 /* float   *se;		accumulated squared error 	*/
 {
-   float   e;		/* current error		*/
+   float   w2[LPC_ORD];	/* squared weights		*/
    long	   besti;	/* best index so far		*/
    float   beste;	/* best error so far		*/
-   long	   j;
    int     i;
-   float   diff;
 
-   besti = 0;
-   beste = 1E32;
-   for(j=0; j<m; j++) {
-	e = 0.0;
-	for(i=0; i<k; i++) {
-	    diff = cb[j*k+i]-vec[i];
-	    e += powf(diff*w[i],2.0);
-	}
-	if (e < beste) {
-	    beste = e;
-	    besti = j;
-	}
-   }
+   /* (diff*w)^2 == w^2*diff^2, in the form the VQ search kernel uses */
+
+   assert(k <= LPC_ORD);
+   for(i=0; i<k; i++)
+       w2[i] = w[i]*w[i];
+
+   besti = kernels->vq_search(cb, m, k, vec, w2, &beste);
 
    *se += beste;
 
@@ -440,48 +434,19 @@ void compute_weights_anssi_mode2(const float *x, float *w, int ndim)
         else
             w[i]=1.0/(0.01+d[i]);
         
-        w[i]=powf(w[i]+0.3, 0.66);
+        w[i]=w[i]+0.3;
   }
+  vpowf(w, w, 0.66, LPC_ORD);
 }
 
 int find_nearest(const float *codebook, int nb_entries, float *x, int ndim)
 {
-  int i, j;
-  float min_dist = 1e15;
-  int nearest = 0;
-  
-  for (i=0;i<nb_entries;i++)
-  {
-    float dist=0;
-    for (j=0;j<ndim;j++)
-      dist += (x[j]-codebook[i*ndim+j])*(x[j]-codebook[i*ndim+j]);
-    if (dist<min_dist)
-    {
-      min_dist = dist;
-      nearest = i;
-    }
-  }
-  return nearest;
+  return kernels->vq_search(codebook, nb_entries, ndim, x, NULL, NULL);
 }
 
 int find_nearest_weighted(const float *codebook, int nb_entries, float *x, const float *w, int ndim)
 {
-  int i, j;
-  float min_dist = 1e15;
-  int nearest = 0;
-  
-  for (i=0;i<nb_entries;i++)
-  {
-    float dist=0;
-    for (j=0;j<ndim;j++)
-      dist += w[j]*(x[j]-codebook[i*ndim+j])*(x[j]-codebook[i*ndim+j]);
-    if (dist<min_dist)
-    {
-      min_dist = dist;
-      nearest = i;
-    }
-  }
-  return nearest;
+  return kernels->vq_search(codebook, nb_entries, ndim, x, w, NULL);
 }
 
 void lspjvm_quantise(float *x, float *xq, int ndim)
@@ -768,7 +733,6 @@ float lpc_model_amplitudes(
   float  ak[]                   /* output aks */
 )
 {
-  float Wn[M];
   float R[LPC_MAX+1];
   float E;
   int   i,j;
@@ -779,9 +743,7 @@ float lpc_model_amplitudes(
   int   roots;                  /* number of LSP roots found */
   float wt[LPC_MAX];
 
-  for(i=0; i<M; i++)
-    Wn[i] = Sn[i]*w[i];
-  autocorrelate(Wn,R,M,order);
+  autocorrelate_windowed(Sn,w,R,M,order);
   levinson_durbin(R,ak,order);
   
   E = 0.0;
@@ -792,7 +754,7 @@ float lpc_model_amplitudes(
       wt[i] = 1.0;
 
   if (lsp_quant) {
-    roots = lpc_to_lsp(ak, order, lsp, 5, LSP_DELTA1);
+    roots = lpc_to_lsp(ak, order, lsp, 5, LSP_DELTA1, NULL);
     if (roots != order)
 	printf("LSP roots not found\n");
 
@@ -982,8 +944,8 @@ void lpc_post_filter(kiss_fft_cfg fft_fwd_cfg, MODEL *model, COMP Pw[], float ak
     #endif
 
     e_after = 1E-4;
+    vpowf(Pfw, Rw, beta, FFT_ENC/2);
     for(i=0; i<FFT_ENC/2; i++) {
-	Pfw[i] = powf(Rw[i], beta);
 	Pw[i].real *= Pfw[i] * Pfw[i];
 	e_after += Pw[i].real;
     }
@@ -1240,35 +1202,34 @@ float decode_Wo_dt(int index, float prev_Wo)
   which are the converted to LSPs for quantisation and transmission
   over the channel.
 
+  lsp_x[] holds the previous frame's LSPs in the x = cos(w) domain to
+  seed the root search, and is updated with this frame's.  It may be
+  NULL, and is only used once it holds a valid set.
+
 \*---------------------------------------------------------------------------*/
 
 float speech_to_uq_lsps(float lsp[],
 			float ak[],
 		        float Sn[], 
 		        float w[],
-		        int   order
+		        int   order,
+			float lsp_x[]
 )
 {
     int   i, roots;
-    float Wn[M];
     float R[LPC_MAX+1];
-    float e, E;
+    float E;
 
-    e = 0.0;
-    for(i=0; i<M; i++) {
-	Wn[i] = Sn[i]*w[i];
-	e += Wn[i]*Wn[i];
-    }
+    autocorrelate_windowed(Sn, w, R, M, order);
 
     /* trap 0 energy case as LPC analysis will fail */
     
-    if (e == 0.0) {
+    if (R[0] == 0.0) {
 	for(i=0; i<order; i++)
 	    lsp[i] = (PI/order)*(float)i;
 	return 0.0;
     }
     
-    autocorrelate(Wn, R, M, order);
     levinson_durbin(R, ak, order);
   
     E = 0.0;
@@ -1283,7 +1244,7 @@ float speech_to_uq_lsps(float lsp[],
     for(i=0; i<=order; i++)
 	ak[i] *= powf(0.994,(float)i);
 
-    roots = lpc_to_lsp(ak, order, lsp, 5, LSP_DELTA1);
+    roots = lpc_to_lsp(ak, order, lsp, 5, LSP_DELTA1, lsp_x);
     if (roots != order) {
 	/* if root finding fails use some benign LSP values instead */
 	for(i=0; i<order; i++)
@@ -1905,7 +1866,7 @@ void quantise_WoE(MODEL *model, float *e, float xq[])
 {
   int          i, n1;
   float        x[2];
-  float        err[2];
+  float        err[2] = { 0.0, 0.0 };
   float        w[2];
   const float *codebook1 = ge_cb[0].cb;
   int          nb_entries = ge_cb[0].m;
@@ -1961,7 +1922,7 @@ int encode_WoE(MODEL *model, float e, float xq[])
 {
   int          i, n1;
   float        x[2];
-  float        err[2];
+  float        err[2] = { 0.0, 0.0 };
   float        w[2];
   const float *codebook1 = ge_cb[0].cb;
   int          nb_entries = ge_cb[0].m;
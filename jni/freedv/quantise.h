@@ -108,7 +108,8 @@ float speech_to_uq_lsps(float lsp[],
 			float ak[],
 		        float Sn[], 
 		        float w[],
-		        int   order
+		        int   order,
+			float lsp_x[]
 			);
 int check_lsp_order(float lsp[], int lpc_order);
 void bw_expand_lsps(float lsp[], int order);
@@ -31,13 +31,17 @@
                                                                              
 \*---------------------------------------------------------------------------*/
 
+#include <assert.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
+#include <string.h>
 
 #include "defines.h"
 #include "sine.h"
 #include "kiss_fft.h"
+#include "kernels.h"
+#include "codec2.h"             /* CODEC2_SYNTH_XXX */
 
 #define HPF_BETA 0.125
 
@@ -47,7 +51,7 @@
                                                                              
 \*---------------------------------------------------------------------------*/
 
-void hs_pitch_refinement(MODEL *model, COMP Sw[], float pmin, float pmax, 
+void hs_pitch_refinement(MODEL *model, float Pw[], float pmin, float pmax, 
 			 float pstep);
 
 /*---------------------------------------------------------------------------*\
@@ -195,19 +199,15 @@ float hpf(float x, float states[])
   AUTHOR......: David Rowe			      
   DATE CREATED: 27/5/94 
 
-  Finds the DFT of the current speech input speech frame.
+  Finds the DFT of the current speech input speech frame.  fftr_fwd_cfg
+  is a FFT_ENC point real forward FFT.
 
 \*---------------------------------------------------------------------------*/
 
-void dft_speech(kiss_fft_cfg fft_fwd_cfg, COMP Sw[], float Sn[], float w[])
+void dft_speech(kiss_fftr_cfg fftr_fwd_cfg, COMP Sw[], float Sn[], float w[])
 {
-  int  i;
-  COMP sw[FFT_ENC];
-
-  for(i=0; i<FFT_ENC; i++) {
-    sw[i].real = 0.0;
-    sw[i].imag = 0.0;
-  }
+  int   i;
+  float sw[FFT_ENC];
 
   /* Centre analysis window on time axis, we need to arrange input
      to FFT this way to make FFT phases correct */
@@ -215,14 +215,26 @@ void dft_speech(kiss_fft_cfg fft_fwd_cfg, COMP Sw[], float Sn[], float w[])
   /* move 2nd half to start of FFT input vector */
 
   for(i=0; i<NW/2; i++)
-    sw[i].real = Sn[i+M/2]*w[i+M/2];
+    sw[i] = Sn[i+M/2]*w[i+M/2];
+
+  /* zero pad between the two halves */
+
+  for(i=NW/2; i<FFT_ENC-NW/2; i++)
+    sw[i] = 0.0;
 
   /* move 1st half to end of FFT input vector */
 
   for(i=0; i<NW/2; i++)
-    sw[FFT_ENC-NW/2+i].real = Sn[i+M/2-NW/2]*w[i+M/2-NW/2];
+    sw[FFT_ENC-NW/2+i] = Sn[i+M/2-NW/2]*w[i+M/2-NW/2];
+
+  /* the input is real, so the real FFT gives bins 0..FFT_ENC/2 and
+     the rest are their complex conjugates */
 
-  kiss_fft(fft_fwd_cfg, (kiss_fft_cpx *)sw, (kiss_fft_cpx *)Sw);
+  kiss_fftr(fftr_fwd_cfg, sw, (kiss_fft_cpx *)Sw);
+  for(i=1; i<FFT_ENC/2; i++) {
+    Sw[FFT_ENC-i].real = Sw[i].real;
+    Sw[FFT_ENC-i].imag = -Sw[i].imag;
+  }
 }
 
 /*---------------------------------------------------------------------------*\
@@ -239,20 +251,25 @@ void dft_speech(kiss_fft_cfg fft_fwd_cfg, COMP Sw[], float Sn[], float w[])
 void two_stage_pitch_refinement(MODEL *model, COMP Sw[])
 {
   float pmin,pmax,pstep;	/* pitch refinment minimum, maximum and step */ 
+  float Pw[FFT_ENC];		/* |Sw|^2, shared by both stages */
+  int   i;
+
+  for(i=0; i<FFT_ENC; i++)
+    Pw[i] = Sw[i].real*Sw[i].real + Sw[i].imag*Sw[i].imag;
 
   /* Coarse refinement */
 
   pmax = TWO_PI/model->Wo + 5;
   pmin = TWO_PI/model->Wo - 5;
   pstep = 1.0;
-  hs_pitch_refinement(model,Sw,pmin,pmax,pstep);
+  hs_pitch_refinement(model,Pw,pmin,pmax,pstep);
   
   /* Fine refinement */
   
   pmax = TWO_PI/model->Wo + 1;
   pmin = TWO_PI/model->Wo - 1;
   pstep = 0.25;
-  hs_pitch_refinement(model,Sw,pmin,pmax,pstep);
+  hs_pitch_refinement(model,Pw,pmin,pmax,pstep);
   
   /* Limit range */
   
@@ -272,25 +289,31 @@ void two_stage_pitch_refinement(MODEL *model, COMP Sw[])
 									  
  Harmonic sum pitch refinement function.			   
 									    
+ Pw     |Sw|^2, the power spectrum
  pmin   pitch search range minimum	    
  pmax	pitch search range maximum	    
  step   pitch search step size		    
  model	current pitch estimate in model.Wo  
 									    
  model 	refined pitch estimate in model.Wo  
+
+ The harmonic sums of all candidates are computed in one
+ kernels->harm_sum() call, several candidates at a time.
 									     
 \*---------------------------------------------------------------------------*/
 
-void hs_pitch_refinement(MODEL *model, COMP Sw[], float pmin, float pmax, float pstep)
+#define MAX_HS_CAND 64          /* candidates per refinement stage */
+
+void hs_pitch_refinement(MODEL *model, float Pw[], float pmin, float pmax, float pstep)
 {
-  int m;		/* loop variable */
-  int b;		/* bin for current harmonic centre */
-  float E;		/* energy for current pitch*/
-  float Wo;		/* current "test" fundamental freq. */
-  float Wom;		/* Wo that maximises E */
-  float Em;		/* mamimum energy */
-  float r;		/* number of rads/bin */
-  float p;		/* current pitch */
+  float Wo[MAX_HS_CAND];	/* candidate fundamentals */
+  float k[MAX_HS_CAND];		/* candidate fundamentals in bins */
+  float E[MAX_HS_CAND];		/* harmonic sum of each candidate */
+  float Wom;			/* Wo that maximises E */
+  float Em;			/* mamimum energy */
+  float r;			/* number of rads/bin */
+  float p;			/* current pitch */
+  int   c, ncand;
   
   /* Initialisation */
   
@@ -299,26 +322,29 @@ void hs_pitch_refinement(MODEL *model, COMP Sw[], float pmin, float pmax, float
   Em = 0.0;
   r = TWO_PI/FFT_ENC;
   
-  /* Determine harmonic sum for a range of Wo values */
-
-  for(p=pmin; p<=pmax; p+=pstep) {
-    E = 0.0;
-    Wo = TWO_PI/p;
-
-    /* Sum harmonic magnitudes */
-
-    for(m=1; m<=model->L; m++) {
-      b = floorf(m*Wo/r + 0.5);
-      E += Sw[b].real*Sw[b].real + Sw[b].imag*Sw[b].imag;
-    }  
-
-    /* Compare to see if this is a maximum */
+  /* Determine harmonic sum for a range of Wo values, pmin < pmax so
+     there is always at least one */
+
+  assert(pmin <= pmax);
+  ncand = 0;
+  p = pmin;
+  do {
+    assert(ncand < MAX_HS_CAND);
+    Wo[ncand] = TWO_PI/p;
+    k[ncand] = Wo[ncand]/r;
+    assert(model->L*k[ncand] + 0.5 < FFT_ENC);
+    ncand++;
+    p += pstep;
+  } while(p <= pmax);
+  kernels->harm_sum(Pw, k, ncand, model->L, E);
+
+  /* Pick the maximum, the first one on a tie */
     
-    if (E > Em) {
-      Em = E;
-      Wom = Wo;
+  for(c=0; c<ncand; c++)
+    if (E[c] > Em) {
+      Em = E[c];
+      Wom = Wo[c];
     }
-  }
 
   model->Wo = Wom;
 }
@@ -329,44 +355,42 @@ void hs_pitch_refinement(MODEL *model, COMP Sw[], float pmin, float pmax, float
   AUTHOR......: David Rowe		
   DATE CREATED: 27/5/94			       
 									      
-  Estimates the complex amplitudes of the harmonics.    
+  Estimates the complex amplitudes of the harmonics.  Phases are only
+  estimated if est_phase is set.
 									      
 \*---------------------------------------------------------------------------*/
 
-void estimate_amplitudes(MODEL *model, COMP Sw[], COMP W[])
+void estimate_amplitudes(MODEL *model, COMP Sw[], COMP W[], int est_phase)
 {
   int   i,m;		/* loop variables */
   int   am,bm;		/* bounds of current harmonic */
   int   b;		/* DFT bin of centre of current harmonic */
   float den;		/* denominator of amplitude expression */
   float r;		/* number of rads/bin */
-  int   offset;
-  COMP  Am;
 
   r = TWO_PI/FFT_ENC;
 
+  /* the upper bound of each harmonic is the lower bound of the next */
+
+  bm = floorf(0.5*model->Wo/r + 0.5);
   for(m=1; m<=model->L; m++) {
-    den = 0.0;
-    am = floorf((m - 0.5)*model->Wo/r + 0.5);
+    am = bm;
     bm = floorf((m + 0.5)*model->Wo/r + 0.5);
-    b = floorf(m*model->Wo/r + 0.5);
 
     /* Estimate ampltude of harmonic */
 
     den = 0.0;
-    Am.real = Am.imag = 0.0;
-    for(i=am; i<bm; i++) {
+    for(i=am; i<bm; i++)
       den += Sw[i].real*Sw[i].real + Sw[i].imag*Sw[i].imag;
-      offset = i + FFT_ENC/2 - floorf(m*model->Wo/r + 0.5);
-      Am.real += Sw[i].real*W[offset].real;
-      Am.imag += Sw[i].imag*W[offset].real;
-    }
 
     model->A[m] = sqrtf(den);
 
-    /* Estimate phase of harmonic */
+    /* Estimate phase of harmonic, not used by the quantised encoder */
 
-    model->phi[m] = atan2f(Sw[b].imag,Sw[b].real);
+    if (est_phase) {
+      b = floorf(m*model->Wo/r + 0.5);
+      model->phi[m] = atan2f(Sw[b].imag,Sw[b].real);
+    }
   }
 }
 
@@ -386,13 +410,15 @@ float est_voicing_mbe(
     COMP   Sw[],
     COMP   W[],
     COMP   Sw_[],         /* DFT of all voiced synthesised signal  */
-                          /* useful for debugging/dump file        */
-    COMP   Ew[],          /* DFT of error                          */
+                          /* useful for debugging/dump file, or NULL */
+    COMP   Ew[],          /* DFT of error, or NULL                 */
     float prev_Wo)
 {
-    int   i,l,al,bl,m;    /* loop variables */
+    int   l,al,bl,m;      /* loop variables */
     COMP  Am;             /* amplitude sample for this band */
+    COMP  s_, e;          /* synthesised sample and error */
     int   offset;         /* centers Hw[] about current harmonic */
+    COMP *Wb;             /* W[] offset to line up with Sw[] */
     float den;            /* denominator of Am expression */
     float error;          /* accumulated error between original and synthesised */
     float Wo;            
@@ -404,12 +430,10 @@ float est_voicing_mbe(
     for(l=1; l<=model->L/4; l++) {
 	sig += model->A[l]*model->A[l];
     }
-    for(i=0; i<FFT_ENC; i++) {
-	Sw_[i].real = 0.0;
-	Sw_[i].imag = 0.0;
-	Ew[i].real = 0.0;
-	Ew[i].imag = 0.0;
-    }
+    if (Sw_ != NULL)
+	memset(Sw_, 0, sizeof(COMP)*FFT_ENC);
+    if (Ew != NULL)
+	memset(Ew, 0, sizeof(COMP)*FFT_ENC);
 
     Wo = model->Wo;
     error = 1E-4;
@@ -423,13 +447,17 @@ float est_voicing_mbe(
 	al = ceilf((l - 0.5)*Wo*FFT_ENC/TWO_PI);
 	bl = ceilf((l + 0.5)*Wo*FFT_ENC/TWO_PI);
 
+	/* W[] is centred on the harmonic, Wb[m] lines up with Sw[m] */
+
+	offset = FFT_ENC/2 + al - l*Wo*FFT_ENC/TWO_PI + 0.5;
+	Wb = &W[offset - al];
+
 	/* Estimate amplitude of harmonic assuming harmonic is totally voiced */
 
 	for(m=al; m<bl; m++) {
-	    offset = FFT_ENC/2 + m - l*Wo*FFT_ENC/TWO_PI + 0.5;
-	    Am.real += Sw[m].real*W[offset].real + Sw[m].imag*W[offset].imag;
-	    Am.imag += Sw[m].imag*W[offset].real - Sw[m].real*W[offset].imag;
-	    den += W[offset].real*W[offset].real + W[offset].imag*W[offset].imag;
+	    Am.real += Sw[m].real*Wb[m].real + Sw[m].imag*Wb[m].imag;
+	    Am.imag += Sw[m].imag*Wb[m].real - Sw[m].real*Wb[m].imag;
+	    den += Wb[m].real*Wb[m].real + Wb[m].imag*Wb[m].imag;
         }
 
         Am.real = Am.real/den;
@@ -438,13 +466,15 @@ float est_voicing_mbe(
         /* Determine error between estimated harmonic and original */
 
         for(m=al; m<bl; m++) {
-	    offset = FFT_ENC/2 + m - l*Wo*FFT_ENC/TWO_PI + 0.5;
-	    Sw_[m].real = Am.real*W[offset].real - Am.imag*W[offset].imag;
-	    Sw_[m].imag = Am.real*W[offset].imag + Am.imag*W[offset].real;
-	    Ew[m].real = Sw[m].real - Sw_[m].real;
-	    Ew[m].imag = Sw[m].imag - Sw_[m].imag;
-	    error += Ew[m].real*Ew[m].real;
-	    error += Ew[m].imag*Ew[m].imag;
+	    s_.real = Am.real*Wb[m].real - Am.imag*Wb[m].imag;
+	    s_.imag = Am.real*Wb[m].imag + Am.imag*Wb[m].real;
+	    e.real = Sw[m].real - s_.real;
+	    e.imag = Sw[m].imag - s_.imag;
+	    error += e.real*e.real + e.imag*e.imag;
+	    if (Sw_ != NULL)
+		Sw_[m] = s_;
+	    if (Ew != NULL)
+		Ew[m] = e;
 	}
     }
     
@@ -544,39 +574,34 @@ void make_synthesis_window(float Pn[])
     Pn[i] = 0.0;
 }
 
-/*---------------------------------------------------------------------------*\
-                                                                             
-  FUNCTION....: synthesise 			      
-  AUTHOR......: David Rowe		
-  DATE CREATED: 20/2/95		       
-									      
-  Synthesise a speech signal in the frequency domain from the
-  sinusodal model parameters.  Uses overlap-add with a trapezoidal
-  window to smoothly interpolate betwen frames.
-									      
-\*---------------------------------------------------------------------------*/
+#define TOL_SYNTH 1E-4          /* synthesis engines against the FFT */
 
-void synthesise(
-  kiss_fft_cfg fft_inv_cfg, 
-  float  Sn_[],		/* time domain synthesised signal              */
-  MODEL *model,		/* ptr to model parameters for this frame      */
-  float  Pn[],		/* time domain Parzen window                   */
-  int    shift          /* flag used to handle transition frames       */
-)
-{
-    int   i,l,j,b;	/* loop variables */
-    COMP  Sw_[FFT_DEC];	/* DFT of synthesised signal */
-    COMP  sw_[FFT_DEC];	/* synthesised signal */
+/* FFT bin of harmonic l, as used by all the synthesis engines */
 
-    if (shift) {
-	/* Update memories */
+static int synth_bin(MODEL *model, int l)
+{
+    int b;
 
-	for(i=0; i<N-1; i++) {
-	    Sn_[i] = Sn_[i+N];
-	}
-	Sn_[N-1] = 0.0;
+    b = floorf(l*model->Wo*FFT_DEC/TWO_PI + 0.5);
+    if (b > ((FFT_DEC/2)-1)) {
+	b = (FFT_DEC/2)-1;
     }
 
+    return b;
+}
+
+/* 
+   Reference engine, inverse complex FFT of the whole spectrum.  All
+   engines write the 2N samples the overlap-add needs to y[], y[i]
+   being the sample at time i-(N-1).
+*/
+
+static void synth_fft(kiss_fft_cfg fft_inv_cfg, float y[], MODEL *model)
+{
+    int   i,l,b;	/* loop variables */
+    COMP  Sw_[FFT_DEC];	/* DFT of synthesised signal */
+    COMP  sw_[FFT_DEC];	/* synthesised signal */
+
     for(i=0; i<FFT_DEC; i++) {
 	Sw_[i].real = 0.0;
 	Sw_[i].imag = 0.0;
@@ -600,12 +625,7 @@ void synthesise(
 #ifdef FFT_SYNTHESIS
     /* Now set up frequency domain synthesised speech */
     for(l=1; l<=model->L; l++) {
-    //for(l=model->L/2; l<=model->L; l++) {
-    //for(l=1; l<=model->L/4; l++) {
-	b = floorf(l*model->Wo*FFT_DEC/TWO_PI + 0.5);
-	if (b > ((FFT_DEC/2)-1)) {
-		b = (FFT_DEC/2)-1;
-	}
+	b = synth_bin(model, l);
 	Sw_[b].real = model->A[l]*cosf(model->phi[l]);
 	Sw_[b].imag = model->A[l]*sinf(model->phi[l]);
 	Sw_[FFT_DEC-b].real = Sw_[b].real;
@@ -624,25 +644,157 @@ void synthesise(
        is zero.
     */
     for(l=1; l<=model->L; l++) {
+	int j;
 	for(i=0,j=-N+1; i<N-1; i++,j++) {
 	    Sw_[FFT_DEC-N+1+i].real += 2.0*model->A[l]*cosf(j*model->Wo*l + model->phi[l]);
 	}
  	for(i=N-1,j=0; i<2*N; i++,j++)
 	    Sw_[j].real += 2.0*model->A[l]*cosf(j*model->Wo*l + model->phi[l]);
     }	
+    for(i=0; i<FFT_DEC; i++)
+	sw_[i] = Sw_[i];
 #endif
 
+    for(i=0; i<N-1; i++)
+	y[i] = sw_[FFT_DEC-N+1+i].real;
+    for(i=N-1; i<2*N; i++)
+	y[i] = sw_[i-(N-1)].real;
+}
+
+/* 
+   Same spectrum through a real inverse FFT, only the positive
+   frequency half is set up and transformed.
+*/
+
+static void synth_fftr(kiss_fftr_cfg fftr_inv_cfg, float y[], MODEL *model)
+{
+    int   i,l,b;
+    COMP  Sw_[FFT_DEC/2+1];
+    float sw_[FFT_DEC];
+
+    for(i=0; i<=FFT_DEC/2; i++) {
+	Sw_[i].real = 0.0;
+	Sw_[i].imag = 0.0;
+    }
+
+    for(l=1; l<=model->L; l++) {
+	b = synth_bin(model, l);
+	Sw_[b].real = model->A[l]*cosf(model->phi[l]);
+	Sw_[b].imag = model->A[l]*sinf(model->phi[l]);
+    }
+
+    kiss_fftri(fftr_inv_cfg, (kiss_fft_cpx *)Sw_, sw_);
+
+    for(i=0; i<N-1; i++)
+	y[i] = sw_[FFT_DEC-N+1+i];
+    for(i=N-1; i<2*N; i++)
+	y[i] = sw_[i-(N-1)];
+}
+
+/* 
+   Oscillator bank, generates just the 2N samples we need as
+   2A*cos(w*n + phi) with a phasor per harmonic that is rotated by
+   exp(jw) each sample.  The frequencies are quantised to the FFT bins
+   and harmonics that share a bin are dropped the same way as the FFT
+   engines, so the output matches them to rounding error.
+*/
+
+static void synth_osc(float y[], MODEL *model)
+{
+    float re[MAX_AMP], im[MAX_AMP], cr[MAX_AMP], ci[MAX_AMP];
+    float w, a, ph;
+    int   l, b, nosc;
+
+    nosc = 0;
+    for(l=1; l<=model->L; l++) {
+	b = synth_bin(model, l);
+
+	/* a later harmonic in the same bin replaces this one */
+
+	if ((l < model->L) && (synth_bin(model, l+1) == b))
+	    continue;
+
+	/* phase at n = -(N-1), the reduction mod 2 pi is exact */
+
+	w  = TWO_PI*b/FFT_DEC;
+	a  = 2.0*model->A[l];
+	ph = model->phi[l] - TWO_PI*((b*(N-1)) % FFT_DEC)/FFT_DEC;
+	re[nosc] = a*cosf(ph);
+	im[nosc] = a*sinf(ph);
+	cr[nosc] = cosf(w);
+	ci[nosc] = sinf(w);
+	nosc++;
+    }
+
+    kernels->osc_bank(y, re, im, cr, ci, nosc, 2*N);
+}
+
+/*---------------------------------------------------------------------------*\
+                                                                             
+  FUNCTION....: synthesise 			      
+  AUTHOR......: David Rowe		
+  DATE CREATED: 20/2/95		       
+									      
+  Synthesise a speech signal in the frequency domain from the
+  sinusodal model parameters.  Uses overlap-add with a trapezoidal
+  window to smoothly interpolate betwen frames.
+
+  engine is one of the CODEC2_SYNTH_XXX engines, CODEC2_SYNTH_FFT is
+  the reference the others are checked against in FREEDV_KERNELS=check
+  mode.
+									      
+\*---------------------------------------------------------------------------*/
+
+void synthesise(
+  kiss_fft_cfg  fft_inv_cfg, 
+  kiss_fftr_cfg fftr_inv_cfg, 
+  int    engine,        /* CODEC2_SYNTH_XXX                            */
+  float  Sn_[],		/* time domain synthesised signal              */
+  MODEL *model,		/* ptr to model parameters for this frame      */
+  float  Pn[],		/* time domain Parzen window                   */
+  int    shift          /* flag used to handle transition frames       */
+)
+{
+    int   i;
+    float y[2*N];       /* synthesised signal, y[i] at time i-(N-1)    */
+    float ref[2*N];
+
+    if (shift) {
+	/* Update memories */
+
+	for(i=0; i<N-1; i++) {
+	    Sn_[i] = Sn_[i+N];
+	}
+	Sn_[N-1] = 0.0;
+    }
+
+    switch(engine) {
+    case CODEC2_SYNTH_FFTR:
+	synth_fftr(fftr_inv_cfg, y, model);
+	break;
+    case CODEC2_SYNTH_OSC:
+	synth_osc(y, model);
+	break;
+    default:
+	synth_fft(fft_inv_cfg, y, model);
+	break;
+    }
+
+    if ((engine != CODEC2_SYNTH_FFT) && kernels_checking()) {
+	synth_fft(fft_inv_cfg, ref, model);
+	kernels_check_float("synthesise", ref, y, 2*N, TOL_SYNTH);
+    }
+
     /* Overlap add to previous samples */
 
     for(i=0; i<N-1; i++) {
-	Sn_[i] += sw_[FFT_DEC-N+1+i].real*Pn[i];
+	Sn_[i] += y[i]*Pn[i];
     }
 
     if (shift)
-	for(i=N-1,j=0; i<2*N; i++,j++)
-	    Sn_[i] = sw_[j].real*Pn[i];
+	for(i=N-1; i<2*N; i++)
+	    Sn_[i] = y[i]*Pn[i];
     else
-	for(i=N-1,j=0; i<2*N; i++,j++)
-	    Sn_[i] += sw_[j].real*Pn[i];
+	for(i=N-1; i<2*N; i++)
+	    Sn_[i] += y[i]*Pn[i];
 }
-
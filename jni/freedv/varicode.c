@@ -29,6 +29,7 @@
 #include <string.h>
 #include "varicode.h"
 #include "varicode_table.h"
+#include "varicode_dec_table.h"
 
 
 /*
@@ -80,6 +81,46 @@ int varicode_encode(short varicode_out[], char ascii_in[], int max_out, int n_in
     return n_out;
 }
 
+/*
+  As varicode_encode() but the output is packed, MSB first, which is
+  the form the modem and codec frames carry.  Each character is
+  written whole in one step from its code and length, a character
+  that would not fit in max_out bits is not started.  Returns the
+  number of bits written, the unused bits of the last byte are 0.
+*/
+
+int varicode_encode_packed(unsigned char varicode_out[], const char ascii_in[], int max_out, int n_in) {
+    unsigned int acc, code;
+    int          n_out, n_acc, len;
+
+    acc = 0; n_acc = 0; n_out = 0;
+
+    while(n_in) {
+        assert((unsigned int)(*ascii_in) < 128);
+
+        code = (varicode_table[2*(unsigned int)*ascii_in] << 8) | varicode_table[2*(unsigned int)*ascii_in+1];
+        len = varicode_bits[(unsigned int)*ascii_in];
+        if (n_out + len > max_out)
+            break;
+        ascii_in++;
+        n_in--;
+
+        /* code is left aligned in 16 bits with zeros after it */
+
+        acc = (acc << len) | (code >> (16 - len));
+        n_acc += len;
+        n_out += len;
+        while (n_acc >= 8) {
+            n_acc -= 8;
+            *varicode_out++ = acc >> n_acc;
+        }
+    }
+    if (n_acc)
+        *varicode_out = acc << (8 - n_acc);
+
+    return n_out;
+}
+
 void varicode_decode_init(struct VARICODE_DEC *dec_states)
 {
     dec_states->state = 0;
@@ -88,10 +129,30 @@ void varicode_decode_init(struct VARICODE_DEC *dec_states)
     dec_states->packed = 0;
 }
 
+/*
+  Looks up a received code, the bits since the first 1 including the
+  two 0s that ended it.  With bit errors there may be no match.
+*/
+
+static int lookup(char *single_ascii, unsigned int packed, int v_len)
+{
+    int ascii;
+
+    /* varicodes start with a 1 so the length is implicit in the index */
+
+    if (v_len - 2 > VARICODE_MAX_BITS - 2)
+        return 0;
+    ascii = varicode_ascii[packed >> 2];
+    if (ascii < 0)
+        return 0;
+    *single_ascii = ascii;
+
+    return 1;
+}
+
 static int decode_one_bit(struct VARICODE_DEC *s, char *single_ascii, short varicode_in)
 {
-    int            found, i;
-    unsigned short byte1, byte2;
+    int            found;
 
     //printf("decode_one_bit : state: %d varicode_in: %d packed: 0x%x n_zeros: %d\n",
     //       s->state, varicode_in, s->packed, s->n_zeros);
@@ -103,35 +164,20 @@ static int decode_one_bit(struct VARICODE_DEC *s, char *single_ascii, short vari
             s->state = 1;
     }
 
+    found = 0;
+
     if (s->state == 1) {
-        if (varicode_in) {
-            s->packed |= (0x8000 >> s->v_len);
+        s->packed = (s->packed << 1) | (varicode_in != 0);
+        if (varicode_in)
             s->n_zeros = 0;
-        }
-        else {
+        else
             s->n_zeros++;
-        }
         s->v_len++;
 
-        found = 0;
-
         /* end of character code */
 
         if (s->n_zeros == 2) {
-            if (s->v_len) {
-                byte1 = s->packed >> 8;
-                byte2 = s->packed & 0xff;
-
-                /* run thru table but note with bit errors means we might
-                   not actually find a match */
-
-                for(i=0; i<128; i++) {
-                    if ((byte1 == varicode_table[2*i]) && (byte2 == varicode_table[2*i+1])) {
-                        found = 1;
-                        *single_ascii = i;
-                    }
-                }
-            }
+            found = lookup(single_ascii, s->packed, s->v_len);
             varicode_decode_init(s);
         }
 
@@ -165,6 +211,58 @@ int varicode_decode(struct VARICODE_DEC *dec_states, char ascii_out[], short var
     return n_out;
 }
 
+/*
+  As varicode_decode() but the input is n_in packed bits, MSB first.
+  Whole bytes are decoded a step at a time from varicode_step[],
+  falling back to decode_one_bit() for a final partial byte, when a
+  code could run too long (a bit error) or when ascii_out[] is nearly
+  full.
+*/
+
+int varicode_decode_packed(struct VARICODE_DEC *dec_states, char ascii_out[], const unsigned char varicode_in[], int max_out, int n_in) {
+    const struct VARICODE_STEP *t;
+    struct VARICODE_DEC        *s = dec_states;
+    unsigned int                byte, packed;
+    int                         n_out, v_len, bit, i;
+    char                        single_ascii;
+
+    n_out = 0;
+
+    for(bit=0; (bit < n_in) && (n_out < max_out); ) {
+        byte = varicode_in[bit >> 3];
+        t = &varicode_step[s->state ? 1 + s->n_zeros : 0][byte];
+
+        if ((n_in - bit < 8) || (max_out - n_out < t->nend) || (s->v_len + t->len[0] > VARICODE_MAX_BITS)) {
+            for(i=0; (i < 8) && (bit < n_in) && (n_out < max_out); i++, bit++) {
+                if (decode_one_bit(s, &single_ascii, (byte >> (7 - i)) & 0x1))
+                    ascii_out[n_out++] = single_ascii;
+            }
+            continue;
+        }
+
+        /* each segment of the byte extends the code, all but the last
+           end a character */
+
+        packed = s->packed;
+        v_len = s->v_len;
+        for(i=0; i<=t->nend; i++) {
+            packed = (packed << t->len[i]) | ((byte >> (8 - t->start[i] - t->len[i])) & ((1 << t->len[i]) - 1));
+            v_len += t->len[i];
+            if (i < t->nend) {
+                n_out += lookup(&ascii_out[n_out], packed, v_len);
+                packed = 0;
+                v_len = 0;
+            }
+        }
+        s->packed = packed;
+        s->v_len = v_len;
+        s->state = t->next != 0;
+        s->n_zeros = t->next == 2;
+        bit += 8;
+    }
+
+    return n_out;
+}
 
 #ifdef VARICODE_UNITTEST
 int main(void) {
@@ -233,6 +331,60 @@ int main(void) {
         assert(n_ascii_chars_out == 0);
     }
 
+    // 3. Packed encoder and table driven decoder against the bit at a time versions ---------
+
+    {
+        struct VARICODE_DEC dec_bits, dec_packed;
+        unsigned char *packed = (unsigned char*)malloc(VARICODE_MAX_BITS*length/8 + 1);
+        char          *ascii_bits = (char*)malloc(VARICODE_MAX_BITS*length);
+        char          *ascii_packed = (char*)malloc(VARICODE_MAX_BITS*length);
+        int            n_bits, n_packed, j, k, fails = 0;
+
+        for(i=0; i<length; i++)
+            ascii_in[i] = (char)i;
+        n_varicode_bits_out = varicode_encode(varicode, ascii_in, VARICODE_MAX_BITS*length, length);
+        n_bits = varicode_encode_packed(packed, ascii_in, VARICODE_MAX_BITS*length, length);
+        assert(n_bits == n_varicode_bits_out);
+        for(i=0; i<n_bits; i++)
+            fails += ((packed[i/8] >> (7 - i%8)) & 1) != varicode[i];
+
+        /* random bit errors, decoded in odd sized pieces to exercise the
+           bit at a time fallback */
+
+        srand(1);
+        for(k=0; k<100; k++) {
+            for(i=0; i<n_bits; i++) {
+                if ((rand() % 16) == 0) {
+                    varicode[i] ^= 1;
+                    packed[i/8] ^= 0x80 >> (i%8);
+                }
+            }
+            varicode_decode_init(&dec_bits);
+            varicode_decode_init(&dec_packed);
+            n_ascii_chars_out = varicode_decode(&dec_bits, ascii_bits, varicode, VARICODE_MAX_BITS*length, n_bits);
+            n_packed = 0;
+            for(i=0; i<n_bits; i+=j) {
+                j = 8*(1 + rand() % 4);
+                if (i + j > n_bits)
+                    j = n_bits - i;
+                assert((i % 8) == 0);
+                n_packed += varicode_decode_packed(&dec_packed, &ascii_packed[n_packed], &packed[i/8],
+                                                   VARICODE_MAX_BITS*length - n_packed, j);
+            }
+            if ((n_packed != n_ascii_chars_out) || memcmp(ascii_bits, ascii_packed, n_packed))
+                fails++;
+        }
+
+        if (fails == 0)
+            printf("Test 3 Pass\n");
+        else
+            printf("Test 3 Fail\n");
+
+        free(packed);
+        free(ascii_bits);
+        free(ascii_packed);
+    }
+
     free(ascii_in);
     free(ascii_out);
     free(varicode);
@@ -34,12 +34,14 @@ struct VARICODE_DEC {
     int            state;
     int            n_zeros;
     int            v_len;
-    unsigned short packed;
+    unsigned short packed;   /* bits of the code so far, last bit received in the LSB */
 };
     
 int varicode_encode(short varicode_out[], char ascii_in[], int max_out, int n_in);
+int varicode_encode_packed(unsigned char varicode_out[], const char ascii_in[], int max_out, int n_in);
 void varicode_decode_init(struct VARICODE_DEC *dec_states);
 int varicode_decode(struct VARICODE_DEC *dec_states, char ascii_out[], short varicode_in[], int max_out, int n_in);
+int varicode_decode_packed(struct VARICODE_DEC *dec_states, char ascii_out[], const unsigned char varicode_in[], int max_out, int n_in);
 
 #ifdef __cplusplus
 }
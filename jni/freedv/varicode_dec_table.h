@@ -0,0 +1,875 @@
+/* Generated by varicode_gen.c from varicode_table.h,
+   do not edit. */
+
+/* ASCII for each code, index is the code with its leading 1 and without
+   the two 0s that end it, -1 if not a code */
+
+static const signed char varicode_ascii[1024] = {
+     -1,  32,  -1, 101,  -1, 116,  -1, 111,  -1,  -1,  -1,  97,  -1, 105,  -1, 110,
+     -1,  -1,  -1,  -1,  -1, 114,  -1, 115,  -1,  -1,  -1, 108,  -1,  10,  -1,  13,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, 104,  -1, 100,  -1,  99,
+     -1,  -1,  -1,  -1,  -1,  45,  -1, 117,  -1,  -1,  -1, 109,  -1, 102,  -1, 112,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  61,  -1,  46,  -1,  -1,  -1, 103,  -1, 121,  -1,  98,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, 119,  -1,  84,  -1,  83,
+     -1,  -1,  -1,  -1,  -1,  44,  -1,  69,  -1,  -1,  -1, 118,  -1,  65,  -1,  73,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  79,  -1,  67,  -1,  82,
+     -1,  -1,  -1,  -1,  -1,  68,  -1,  48,  -1,  -1,  -1,  77,  -1,  49,  -1, 107,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  80,  -1,  76,  -1,  -1,  -1,  70,  -1,  78,  -1, 120,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  66,  -1,  50,  -1,   9,
+     -1,  -1,  -1,  -1,  -1,  58,  -1,  41,  -1,  -1,  -1,  40,  -1,  71,  -1,  51,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  72,  -1,  85,  -1,  -1,  -1,  53,  -1,  87,  -1,  34,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  54,  -1,  95,  -1,  42,
+     -1,  -1,  -1,  -1,  -1,  88,  -1,  52,  -1,  -1,  -1,  89,  -1,  75,  -1,  39,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  56,  -1,  55,  -1,  47,
+     -1,  -1,  -1,  -1,  -1,  86,  -1,  57,  -1,  -1,  -1, 124,  -1,  59,  -1, 113,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1, 122,  -1,  62,  -1,  -1,  -1,  36,  -1,  81,  -1,  43,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, 106,  -1,  60,  -1,  92,
+     -1,  -1,  -1,  -1,  -1,  35,  -1,  91,  -1,  -1,  -1,  93,  -1,  74,  -1,  33,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,   0,  -1,  90,  -1,  63,
+     -1,  -1,  -1,  -1,  -1, 125,  -1, 123,  -1,  -1,  -1,  38,  -1,  64,  -1,  94,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  37,  -1, 126,  -1,  -1,  -1,   1,  -1,  12,  -1,  96,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,   4,  -1,   2,  -1,   6,
+     -1,  -1,  -1,  -1,  -1,  17,  -1,  16,  -1,  -1,  -1,  30,  -1,   7,  -1,   8,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  27,  -1,  23,  -1,  -1,  -1,  20,  -1,  28,  -1,   5,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  21,  -1,  22,  -1,  11,
+     -1,  -1,  -1,  -1,  -1,  14,  -1,   3,  -1,  -1,  -1,  24,  -1,  25,  -1,  31,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  15,  -1,  18,  -1,  19,
+     -1,  -1,  -1,  -1,  -1, 127,  -1,  26,  -1,  -1,  -1,  29,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+};
+
+/* bits sent for each character, the code plus the two 0s that end it */
+
+static const unsigned char varicode_bits[128] = {
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 10,  7, 12, 12,  7, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+     3, 11, 11, 11, 11, 12, 12, 11, 10, 10, 11, 11,  9,  8,  9, 11,
+    10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 10, 11, 11,  9, 11, 12,
+    12,  9, 10, 10, 10,  9, 10, 10, 11,  9, 11, 11, 10, 10, 10, 10,
+    10, 11, 10,  9,  9, 11, 11, 11, 11, 11, 12, 11, 11, 11, 12, 11,
+    12,  6,  9,  8,  8,  4,  8,  9,  8,  6, 11, 10,  7,  8,  6,  5,
+     8, 11,  7,  7,  5,  8,  9,  9, 10,  9, 11, 12, 11, 12, 12, 12,
+};
+
+/* decoder step for a byte in each state, idle, after a 1 and after a
+   single 0.  Bits start[i]..start[i]+len[i]-1 of the byte, MSB
+   first, extend the code, segments 0..nend-1 each end a
+   character. */
+
+struct VARICODE_STEP {
+    unsigned char next;
+    unsigned char nend;
+    unsigned char start[4];
+    unsigned char len[4];
+};
+
+static const struct VARICODE_STEP varicode_step[3][256] = {
+  {
+    { 0, 0, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+    { 1, 0, { 7, 0, 0, 0 }, { 1, 0, 0, 0 } },
+    { 2, 0, { 6, 0, 0, 0 }, { 2, 0, 0, 0 } },
+    { 1, 0, { 6, 0, 0, 0 }, { 2, 0, 0, 0 } },
+    { 0, 1, { 5, 0, 0, 0 }, { 3, 0, 0, 0 } },
+    { 1, 0, { 5, 0, 0, 0 }, { 3, 0, 0, 0 } },
+    { 2, 0, { 5, 0, 0, 0 }, { 3, 0, 0, 0 } },
+    { 1, 0, { 5, 0, 0, 0 }, { 3, 0, 0, 0 } },
+    { 0, 1, { 4, 0, 0, 0 }, { 3, 0, 0, 0 } },
+    { 1, 1, { 4, 7, 0, 0 }, { 3, 1, 0, 0 } },
+    { 2, 0, { 4, 0, 0, 0 }, { 4, 0, 0, 0 } },
+    { 1, 0, { 4, 0, 0, 0 }, { 4, 0, 0, 0 } },
+    { 0, 1, { 4, 0, 0, 0 }, { 4, 0, 0, 0 } },
+    { 1, 0, { 4, 0, 0, 0 }, { 4, 0, 0, 0 } },
+    { 2, 0, { 4, 0, 0, 0 }, { 4, 0, 0, 0 } },
+    { 1, 0, { 4, 0, 0, 0 }, { 4, 0, 0, 0 } },
+    { 0, 1, { 3, 0, 0, 0 }, { 3, 0, 0, 0 } },
+    { 1, 1, { 3, 7, 0, 0 }, { 3, 1, 0, 0 } },
+    { 2, 1, { 3, 6, 0, 0 }, { 3, 2, 0, 0 } },
+    { 1, 1, { 3, 6, 0, 0 }, { 3, 2, 0, 0 } },
+    { 0, 1, { 3, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 0, { 3, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 2, 0, { 3, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 0, { 3, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 0, 1, { 3, 0, 0, 0 }, { 4, 0, 0, 0 } },
+    { 1, 1, { 3, 7, 0, 0 }, { 4, 1, 0, 0 } },
+    { 2, 0, { 3, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 0, { 3, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 0, 1, { 3, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 0, { 3, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 2, 0, { 3, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 0, { 3, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 0, 1, { 2, 0, 0, 0 }, { 3, 0, 0, 0 } },
+    { 1, 1, { 2, 7, 0, 0 }, { 3, 1, 0, 0 } },
+    { 2, 1, { 2, 6, 0, 0 }, { 3, 2, 0, 0 } },
+    { 1, 1, { 2, 6, 0, 0 }, { 3, 2, 0, 0 } },
+    { 0, 2, { 2, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 1, { 2, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 2, 1, { 2, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 1, { 2, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 0, 1, { 2, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 1, { 2, 7, 0, 0 }, { 5, 1, 0, 0 } },
+    { 2, 0, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 0, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 0, 1, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 0, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 2, 0, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 0, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 0, 1, { 2, 0, 0, 0 }, { 4, 0, 0, 0 } },
+    { 1, 1, { 2, 7, 0, 0 }, { 4, 1, 0, 0 } },
+    { 2, 1, { 2, 6, 0, 0 }, { 4, 2, 0, 0 } },
+    { 1, 1, { 2, 6, 0, 0 }, { 4, 2, 0, 0 } },
+    { 0, 1, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 0, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 2, 0, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 0, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 0, 1, { 2, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 1, { 2, 7, 0, 0 }, { 5, 1, 0, 0 } },
+    { 2, 0, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 0, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 0, 1, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 0, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 2, 0, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 0, { 2, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 0, 1, { 1, 0, 0, 0 }, { 3, 0, 0, 0 } },
+    { 1, 1, { 1, 7, 0, 0 }, { 3, 1, 0, 0 } },
+    { 2, 1, { 1, 6, 0, 0 }, { 3, 2, 0, 0 } },
+    { 1, 1, { 1, 6, 0, 0 }, { 3, 2, 0, 0 } },
+    { 0, 2, { 1, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 1, { 1, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 2, 1, { 1, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 1, { 1, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 0, 2, { 1, 4, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 2, { 1, 4, 7, 0 }, { 3, 3, 1, 0 } },
+    { 2, 1, { 1, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 1, { 1, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 0, 2, { 1, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 1, { 1, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 2, 1, { 1, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 1, { 1, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 0, 1, { 1, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 1, { 1, 7, 0, 0 }, { 5, 1, 0, 0 } },
+    { 2, 1, { 1, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 1, 1, { 1, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 0, 1, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 2, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 0, 1, { 1, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 1, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 0, 1, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 2, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 0, 1, { 1, 0, 0, 0 }, { 4, 0, 0, 0 } },
+    { 1, 1, { 1, 7, 0, 0 }, { 4, 1, 0, 0 } },
+    { 2, 1, { 1, 6, 0, 0 }, { 4, 2, 0, 0 } },
+    { 1, 1, { 1, 6, 0, 0 }, { 4, 2, 0, 0 } },
+    { 0, 2, { 1, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 1, { 1, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 2, 1, { 1, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 1, { 1, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 0, 1, { 1, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 1, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 0, 1, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 2, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 0, 1, { 1, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 1, { 1, 7, 0, 0 }, { 5, 1, 0, 0 } },
+    { 2, 1, { 1, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 1, 1, { 1, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 0, 1, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 2, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 0, 1, { 1, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 1, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 0, 1, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 2, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 0, { 1, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 3, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 3, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 3, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 3, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 2, { 0, 4, 7, 0 }, { 3, 3, 1, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 2, { 0, 3, 7, 0 }, { 3, 3, 1, 0 } },
+    { 2, 2, { 0, 3, 6, 0 }, { 3, 3, 2, 0 } },
+    { 1, 2, { 0, 3, 6, 0 }, { 3, 3, 2, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 2, { 0, 3, 7, 0 }, { 3, 4, 1, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 5, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 4, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 4, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 4, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 4, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 2, { 0, 4, 7, 0 }, { 4, 3, 1, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 5, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+  },
+  {
+    { 0, 1, { 0, 0, 0, 0 }, { 2, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 2, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 2, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 2, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 2, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 2, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 2, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 2, 3, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 2, 3, 0, 0 } },
+    { 1, 2, { 0, 4, 7, 0 }, { 2, 3, 1, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 2, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 2, 4, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 2, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 2, 4, 0, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 2, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 2, 4, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 2, 3, 0, 0 } },
+    { 1, 2, { 0, 3, 7, 0 }, { 2, 3, 1, 0 } },
+    { 2, 2, { 0, 3, 6, 0 }, { 2, 3, 2, 0 } },
+    { 1, 2, { 0, 3, 6, 0 }, { 2, 3, 2, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 2, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 2, 5, 0, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 2, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 2, 5, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 2, 4, 0, 0 } },
+    { 1, 2, { 0, 3, 7, 0 }, { 2, 4, 1, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 2, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 2, 5, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 2, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 2, 5, 0, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 2, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 2, 5, 0, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 2, 3, 0, 0 } },
+    { 1, 2, { 0, 2, 7, 0 }, { 2, 3, 1, 0 } },
+    { 2, 2, { 0, 2, 6, 0 }, { 2, 3, 2, 0 } },
+    { 1, 2, { 0, 2, 6, 0 }, { 2, 3, 2, 0 } },
+    { 0, 3, { 0, 2, 5, 0 }, { 2, 3, 3, 0 } },
+    { 1, 2, { 0, 2, 5, 0 }, { 2, 3, 3, 0 } },
+    { 2, 2, { 0, 2, 5, 0 }, { 2, 3, 3, 0 } },
+    { 1, 2, { 0, 2, 5, 0 }, { 2, 3, 3, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 2, 5, 0, 0 } },
+    { 1, 2, { 0, 2, 7, 0 }, { 2, 5, 1, 0 } },
+    { 2, 1, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 2, 1, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 2, 4, 0, 0 } },
+    { 1, 2, { 0, 2, 7, 0 }, { 2, 4, 1, 0 } },
+    { 2, 2, { 0, 2, 6, 0 }, { 2, 4, 2, 0 } },
+    { 1, 2, { 0, 2, 6, 0 }, { 2, 4, 2, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 2, 1, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 2, 5, 0, 0 } },
+    { 1, 2, { 0, 2, 7, 0 }, { 2, 5, 1, 0 } },
+    { 2, 1, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 2, 1, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 2, 6, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 4, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 4, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 4, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 4, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 2, { 0, 4, 7, 0 }, { 4, 3, 1, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 5, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 3, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 3, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 3, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 3, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 2, { 0, 4, 7, 0 }, { 3, 3, 1, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 2, { 0, 3, 7, 0 }, { 3, 3, 1, 0 } },
+    { 2, 2, { 0, 3, 6, 0 }, { 3, 3, 2, 0 } },
+    { 1, 2, { 0, 3, 6, 0 }, { 3, 3, 2, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 2, { 0, 3, 7, 0 }, { 3, 4, 1, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 5, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 4, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 4, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 4, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 4, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 2, { 0, 4, 7, 0 }, { 4, 3, 1, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 5, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+  },
+  {
+    { 0, 1, { 0, 0, 0, 0 }, { 1, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 1, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 1, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 1, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 1, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 1, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 1, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 1, 3, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 1, 3, 0, 0 } },
+    { 1, 2, { 0, 4, 7, 0 }, { 1, 3, 1, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 1, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 1, 4, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 1, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 1, 4, 0, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 1, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 1, 4, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 1, 3, 0, 0 } },
+    { 1, 2, { 0, 3, 7, 0 }, { 1, 3, 1, 0 } },
+    { 2, 2, { 0, 3, 6, 0 }, { 1, 3, 2, 0 } },
+    { 1, 2, { 0, 3, 6, 0 }, { 1, 3, 2, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 1, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 1, 5, 0, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 1, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 1, 5, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 1, 4, 0, 0 } },
+    { 1, 2, { 0, 3, 7, 0 }, { 1, 4, 1, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 1, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 1, 5, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 1, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 1, 5, 0, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 1, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 1, 5, 0, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 1, 3, 0, 0 } },
+    { 1, 2, { 0, 2, 7, 0 }, { 1, 3, 1, 0 } },
+    { 2, 2, { 0, 2, 6, 0 }, { 1, 3, 2, 0 } },
+    { 1, 2, { 0, 2, 6, 0 }, { 1, 3, 2, 0 } },
+    { 0, 3, { 0, 2, 5, 0 }, { 1, 3, 3, 0 } },
+    { 1, 2, { 0, 2, 5, 0 }, { 1, 3, 3, 0 } },
+    { 2, 2, { 0, 2, 5, 0 }, { 1, 3, 3, 0 } },
+    { 1, 2, { 0, 2, 5, 0 }, { 1, 3, 3, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 1, 5, 0, 0 } },
+    { 1, 2, { 0, 2, 7, 0 }, { 1, 5, 1, 0 } },
+    { 2, 1, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 2, 1, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 1, 4, 0, 0 } },
+    { 1, 2, { 0, 2, 7, 0 }, { 1, 4, 1, 0 } },
+    { 2, 2, { 0, 2, 6, 0 }, { 1, 4, 2, 0 } },
+    { 1, 2, { 0, 2, 6, 0 }, { 1, 4, 2, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 2, 1, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 1, 5, 0, 0 } },
+    { 1, 2, { 0, 2, 7, 0 }, { 1, 5, 1, 0 } },
+    { 2, 1, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 0, 2, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 2, 1, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 1, 1, { 0, 2, 0, 0 }, { 1, 6, 0, 0 } },
+    { 0, 2, { 0, 1, 0, 0 }, { 1, 3, 0, 0 } },
+    { 1, 2, { 0, 1, 7, 0 }, { 1, 3, 1, 0 } },
+    { 2, 2, { 0, 1, 6, 0 }, { 1, 3, 2, 0 } },
+    { 1, 2, { 0, 1, 6, 0 }, { 1, 3, 2, 0 } },
+    { 0, 3, { 0, 1, 5, 0 }, { 1, 3, 3, 0 } },
+    { 1, 2, { 0, 1, 5, 0 }, { 1, 3, 3, 0 } },
+    { 2, 2, { 0, 1, 5, 0 }, { 1, 3, 3, 0 } },
+    { 1, 2, { 0, 1, 5, 0 }, { 1, 3, 3, 0 } },
+    { 0, 3, { 0, 1, 4, 0 }, { 1, 3, 3, 0 } },
+    { 1, 3, { 0, 1, 4, 7 }, { 1, 3, 3, 1 } },
+    { 2, 2, { 0, 1, 4, 0 }, { 1, 3, 4, 0 } },
+    { 1, 2, { 0, 1, 4, 0 }, { 1, 3, 4, 0 } },
+    { 0, 3, { 0, 1, 4, 0 }, { 1, 3, 4, 0 } },
+    { 1, 2, { 0, 1, 4, 0 }, { 1, 3, 4, 0 } },
+    { 2, 2, { 0, 1, 4, 0 }, { 1, 3, 4, 0 } },
+    { 1, 2, { 0, 1, 4, 0 }, { 1, 3, 4, 0 } },
+    { 0, 2, { 0, 1, 0, 0 }, { 1, 5, 0, 0 } },
+    { 1, 2, { 0, 1, 7, 0 }, { 1, 5, 1, 0 } },
+    { 2, 2, { 0, 1, 6, 0 }, { 1, 5, 2, 0 } },
+    { 1, 2, { 0, 1, 6, 0 }, { 1, 5, 2, 0 } },
+    { 0, 2, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 1, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 2, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 1, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 0, 2, { 0, 1, 0, 0 }, { 1, 6, 0, 0 } },
+    { 1, 2, { 0, 1, 7, 0 }, { 1, 6, 1, 0 } },
+    { 2, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 1, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 0, 2, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 1, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 2, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 1, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 0, 2, { 0, 1, 0, 0 }, { 1, 4, 0, 0 } },
+    { 1, 2, { 0, 1, 7, 0 }, { 1, 4, 1, 0 } },
+    { 2, 2, { 0, 1, 6, 0 }, { 1, 4, 2, 0 } },
+    { 1, 2, { 0, 1, 6, 0 }, { 1, 4, 2, 0 } },
+    { 0, 3, { 0, 1, 5, 0 }, { 1, 4, 3, 0 } },
+    { 1, 2, { 0, 1, 5, 0 }, { 1, 4, 3, 0 } },
+    { 2, 2, { 0, 1, 5, 0 }, { 1, 4, 3, 0 } },
+    { 1, 2, { 0, 1, 5, 0 }, { 1, 4, 3, 0 } },
+    { 0, 2, { 0, 1, 0, 0 }, { 1, 6, 0, 0 } },
+    { 1, 2, { 0, 1, 7, 0 }, { 1, 6, 1, 0 } },
+    { 2, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 1, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 0, 2, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 1, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 2, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 1, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 0, 2, { 0, 1, 0, 0 }, { 1, 5, 0, 0 } },
+    { 1, 2, { 0, 1, 7, 0 }, { 1, 5, 1, 0 } },
+    { 2, 2, { 0, 1, 6, 0 }, { 1, 5, 2, 0 } },
+    { 1, 2, { 0, 1, 6, 0 }, { 1, 5, 2, 0 } },
+    { 0, 2, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 1, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 2, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 1, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 0, 2, { 0, 1, 0, 0 }, { 1, 6, 0, 0 } },
+    { 1, 2, { 0, 1, 7, 0 }, { 1, 6, 1, 0 } },
+    { 2, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 1, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 0, 2, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 1, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 2, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 1, 1, { 0, 1, 0, 0 }, { 1, 7, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 3, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 3, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 3, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 3, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 3, 3, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 2, { 0, 4, 7, 0 }, { 3, 3, 1, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 3, 4, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 3, 3, 0, 0 } },
+    { 1, 2, { 0, 3, 7, 0 }, { 3, 3, 1, 0 } },
+    { 2, 2, { 0, 3, 6, 0 }, { 3, 3, 2, 0 } },
+    { 1, 2, { 0, 3, 6, 0 }, { 3, 3, 2, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 3, 4, 0, 0 } },
+    { 1, 2, { 0, 3, 7, 0 }, { 3, 4, 1, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 0, 2, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 2, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 1, 1, { 0, 3, 0, 0 }, { 3, 5, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 5, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 4, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 4, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 4, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 4, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 4, 3, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 4, 3, 0, 0 } },
+    { 1, 2, { 0, 4, 7, 0 }, { 4, 3, 1, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 0, 2, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 2, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 1, 1, { 0, 4, 0, 0 }, { 4, 4, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 5, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 5, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 5, 2, 0, 0 } },
+    { 0, 2, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 2, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 1, 1, { 0, 5, 0, 0 }, { 5, 3, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 6, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 6, 1, 0, 0 } },
+    { 2, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 1, 1, { 0, 6, 0, 0 }, { 6, 2, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 7, 0, 0, 0 } },
+    { 1, 1, { 0, 7, 0, 0 }, { 7, 1, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 0, 1, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 2, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+    { 1, 0, { 0, 0, 0, 0 }, { 8, 0, 0, 0 } },
+  },
+};
+
@@ -0,0 +1,125 @@
+//==========================================================================
+// Name:            varicode_gen.c
+// Purpose:         Generates the varicode decoder tables
+// Created:         19 Oct 2026
+//
+// To rebuild varicode_dec_table.h after changing varicode_table.h:
+//          $ gcc varicode_gen.c -o varicode_gen -Wall
+//          $ ./varicode_gen > varicode_dec_table.h
+// 
+// License:
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License version 2.1,
+//  as published by the Free Software Foundation.  This program is
+//  distributed in the hope that it will be useful, but WITHOUT ANY
+//  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+//  License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+//==========================================================================
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "varicode.h"
+#include "varicode_table.h"
+
+/*
+  Prints varicode_dec_table.h.  The step table is made by running
+  each byte through a decoder in each of its three states, idle,
+  after a 1 and after a single 0, noting where codes end.
+*/
+
+int main(void) {
+    signed char ascii[1 << (VARICODE_MAX_BITS - 2)];
+    int         bits[128];
+    unsigned    code;
+    int         c, i, st, byte, b, state, n_zeros, nend, len, start;
+    int         starts[4], lens[4];
+
+    memset(ascii, -1, sizeof(ascii));
+    for(c=0; c<128; c++) {
+        code = (varicode_table[2*c] << 8) | varicode_table[2*c+1];
+        for(len=16; !(code & (1 << (16 - len))); len--)
+            ;
+        assert(len <= VARICODE_MAX_BITS - 2);
+        assert(ascii[code >> (16 - len)] == -1);
+        ascii[code >> (16 - len)] = c;
+        bits[c] = len + 2;
+    }
+
+    printf("/* Generated by varicode_gen.c from varicode_table.h,\n"
+           "   do not edit. */\n\n");
+
+    printf("/* ASCII for each code, index is the code with its leading 1 and without\n"
+           "   the two 0s that end it, -1 if not a code */\n\n");
+    printf("static const signed char varicode_ascii[%d] = {", (int)sizeof(ascii));
+    for(i=0; i<(int)sizeof(ascii); i++)
+        printf("%s%4d,", (i % 16) ? "" : "\n   ", ascii[i]);
+    printf("\n};\n\n");
+
+    printf("/* bits sent for each character, the code plus the two 0s that end it */\n\n");
+    printf("static const unsigned char varicode_bits[128] = {");
+    for(c=0; c<128; c++)
+        printf("%s%3d,", (c % 16) ? "" : "\n   ", bits[c]);
+    printf("\n};\n\n");
+
+    printf("/* decoder step for a byte in each state, idle, after a 1 and after a\n"
+           "   single 0.  Bits start[i]..start[i]+len[i]-1 of the byte, MSB\n"
+           "   first, extend the code, segments 0..nend-1 each end a\n"
+           "   character. */\n\n");
+    printf("struct VARICODE_STEP {\n"
+           "    unsigned char next;\n"
+           "    unsigned char nend;\n"
+           "    unsigned char start[4];\n"
+           "    unsigned char len[4];\n"
+           "};\n\n");
+    printf("static const struct VARICODE_STEP varicode_step[3][256] = {\n");
+    for(st=0; st<3; st++) {
+        printf("  {\n");
+        for(byte=0; byte<256; byte++) {
+            state = st != 0;
+            n_zeros = st == 2;
+            nend = 0;
+            memset(starts, 0, sizeof(starts));
+            memset(lens, 0, sizeof(lens));
+            start = -1;
+            for(b=0; b<8; b++) {
+                int in = (byte >> (7 - b)) & 0x1;
+
+                if (!state) {
+                    if (!in)
+                        continue;
+                    state = 1;
+                }
+                if (start < 0)
+                    start = b;
+                n_zeros = in ? 0 : n_zeros + 1;
+                if (n_zeros == 2) {
+                    assert(nend < 3);
+                    starts[nend] = start;
+                    lens[nend] = b + 1 - start;
+                    nend++;
+                    state = 0;
+                    n_zeros = 0;
+                    start = -1;
+                }
+            }
+            if (start >= 0) {
+                starts[nend] = start;
+                lens[nend] = 8 - start;
+            }
+            printf("    { %d, %d, { %d, %d, %d, %d }, { %d, %d, %d, %d } },\n",
+                   state ? 1 + n_zeros : 0, nend, starts[0], starts[1], starts[2], starts[3],
+                   lens[0], lens[1], lens[2], lens[3]);
+        }
+        printf("  },\n");
+    }
+    printf("};\n\n");
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: vmath.h
+  DATE CREATED: 19 Oct 2026
+
+  Array in, array out approximations of the libm functions used in
+  the per frame DSP, see vmath.c for the error bounds.  Output arrays
+  may be the same as the input arrays.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __VMATH__
+#define __VMATH__
+
+/* y[i] = log10(x[i]), x[i] > 0 */
+
+void vlog10f(float y[], const float x[], int n);
+
+/* y[i] = 10^x[i] */
+
+void vexp10f(float y[], const float x[], int n);
+
+/* y[i] = x[i]^p, x[i] > 0 */
+
+void vpowf(float y[], const float x[], float p, int n);
+
+/* y[i] = atan2(im[i], re[i]), 0 when both are 0 */
+
+void vatan2f(float y[], const float im[], const float re[], int n);
+
+/* s[i] = sin(x[i]), c[i] = cos(x[i]) */
+
+void vsincosf(float s[], float c[], const float x[], int n);
+
+#endif
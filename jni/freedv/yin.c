@@ -0,0 +1,209 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: yin.c
+  DATE CREATED: 19 Oct 2026
+
+  YIN pitch estimator [1], a cheaper alternative to nlp() for bulk
+  encoding and low power transmit, selected with
+  codec2_set_pitch_engine().
+
+  The difference function d(tau) is a sum over the integration window
+  of (x[j] - x[j+tau])^2.  The window is split into blocks of n
+  samples, the frame shift, and the partial sums of each block are
+  kept between calls.  As Sn[] moves along by n samples per call only
+  the newest block has to be computed, the older blocks are reused and
+  the oldest one is dropped.  Keeping the blocks rather than adding
+  and subtracting the terms at the window edges means rounding errors
+  do not build up over time.
+
+  References:
+
+    [1] A. de Cheveigne and H. Kawahara, "YIN, a fundamental frequency
+        estimator for speech and music", JASA 111(4), 2002.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "defines.h"
+#include "yin.h"
+#include "kernels.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*\
+
+ 				DEFINES
+
+\*---------------------------------------------------------------------------*/
+
+#define YIN_MAX_LAG    300      /* largest pmax supported               */
+#define YIN_MAX_BLOCKS 8        /* largest (m-pmax)/n supported         */
+#define YIN_THRESH     0.2      /* absolute threshold on d'(tau)        */
+
+typedef struct {
+    float block[YIN_MAX_BLOCKS][YIN_MAX_LAG+1]; /* d(tau) of each block */
+    int   oldest;               /* next block to replace                */
+    int   nblocks;              /* blocks in the integration window     */
+    int   n, m, pmax;           /* layout the blocks were computed for  */
+} YIN;
+
+/*---------------------------------------------------------------------------*\
+
+  yin_create()
+
+  Initialisation function for the YIN pitch estimator.
+
+\*---------------------------------------------------------------------------*/
+
+void *yin_create(void)
+{
+    YIN *yin;
+
+    yin = (YIN*)malloc(sizeof(YIN));
+    if (yin == NULL)
+	return NULL;
+    kernels_init();
+
+    yin->oldest = 0;
+    yin->nblocks = 0;
+    yin->n = yin->m = yin->pmax = 0;
+
+    return (void*)yin;
+}
+
+void yin_destroy(void *yin_state)
+{
+    assert(yin_state != NULL);
+    free(yin_state);
+}
+
+/*
+  d(tau), tau = 0..pmax, of the n sample block starting at x[0],
+  using (a-b)^2 = a^2 + b^2 - 2ab so the cross terms are dot products.
+*/
+
+static void block_diff(float d[], const float x[], int n, int pmax)
+{
+    double e0, et;
+    int    j, tau;
+
+    e0 = 0.0;
+    for(j=0; j<n; j++)
+	e0 += x[j]*x[j];
+
+    d[0] = 0.0;
+    et = e0;
+    for(tau=1; tau<=pmax; tau++) {
+	et += x[n+tau-1]*x[n+tau-1] - x[tau-1]*x[tau-1];
+	d[tau] = e0 + et - 2.0*kernels->dot(x, &x[tau], n);
+	if (d[tau] < 0.0)
+	    d[tau] = 0.0;
+    }
+}
+
+/*---------------------------------------------------------------------------*\
+
+  yin()
+
+  Estimates the pitch of Sn[], same arguments and return value as
+  nlp().  Sn[] must move along by n samples each call, as it does in
+  the encoder.  Sw[], W[] and prev_Wo are not used.
+
+\*---------------------------------------------------------------------------*/
+
+float yin(
+  void  *yin_state,
+  float  Sn[],			/* input speech vector */
+  int    n,			/* frames shift (no. new samples in Sn[]) */
+  int    m,			/* analysis window size */
+  int    pmin,                  /* minimum pitch value */
+  int    pmax,			/* maximum pitch value */
+  float *pitch,			/* estimated pitch period in samples */
+  COMP   Sw[],                  /* Freq domain version of Sn[] */
+  COMP   W[],                   /* Freq domain window */
+  float *prev_Wo
+)
+{
+    YIN   *yin;
+    float  d[YIN_MAX_LAG+1];    /* d'(tau), cumulative mean normalised */
+    float  sum, a, b, c, den, p;
+    int    i, tau, best, start;
+
+    assert(yin_state != NULL);
+    yin = (YIN*)yin_state;
+    assert((pmin > 1) && (pmin < pmax) && (pmax <= YIN_MAX_LAG));
+    assert((n > 0) && (m - pmax >= n));
+
+    /* integration window is the nblocks*n samples before Sn[m-pmax],
+       so the largest lag reaches the end of Sn[] */
+
+    if ((n != yin->n) || (m != yin->m) || (pmax != yin->pmax)) {
+	yin->n = n; yin->m = m; yin->pmax = pmax;
+	yin->nblocks = (m - pmax)/n;
+	if (yin->nblocks > YIN_MAX_BLOCKS)
+	    yin->nblocks = YIN_MAX_BLOCKS;
+	start = m - pmax - yin->nblocks*n;
+	for(i=0; i<yin->nblocks; i++)
+	    block_diff(yin->block[i], &Sn[start + i*n], n, pmax);
+	yin->oldest = 0;
+    }
+    else {
+	block_diff(yin->block[yin->oldest], &Sn[m - pmax - n], n, pmax);
+	yin->oldest = (yin->oldest + 1) % yin->nblocks;
+    }
+
+    /* d'(tau) = d(tau)/((1/tau) sum of d(1..tau)) */
+
+    d[0] = 1.0;
+    sum = 0.0;
+    for(tau=1; tau<=pmax; tau++) {
+	d[tau] = 0.0;
+	for(i=0; i<yin->nblocks; i++)
+	    d[tau] += yin->block[i][tau];
+	sum += d[tau];
+	d[tau] = (sum > 0.0) ? d[tau]*tau/sum : 1.0;
+    }
+
+    /* first dip under the threshold, else the global minimum */
+
+    best = pmin;
+    for(tau=pmin; tau<=pmax; tau++)
+	if (d[tau] < d[best])
+	    best = tau;
+    for(tau=pmin; tau<=pmax; tau++)
+	if (d[tau] < YIN_THRESH) {
+	    while((tau < pmax) && (d[tau+1] < d[tau]))
+		tau++;
+	    best = tau;
+	    break;
+	}
+
+    /* parabolic interpolation between lags */
+
+    p = best;
+    if ((best > pmin) && (best < pmax)) {
+	a = d[best-1]; b = d[best]; c = d[best+1];
+	den = a - 2.0*b + c;
+	if (den > 0.0)
+	    p += 0.5*(a - c)/den;
+    }
+
+    *pitch = p;
+    return (float)FS/p;
+}
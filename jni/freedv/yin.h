@@ -0,0 +1,35 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: yin.h
+  DATE CREATED: 19 Oct 2026
+
+  Low complexity YIN pitch estimator.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __YIN__
+#define __YIN__
+
+#include "comp.h"
+
+void *yin_create(void);
+void yin_destroy(void *yin_state);
+float yin(void *yin_state, float Sn[], int n, int m, int pmin, int pmax,
+	  float *pitch, COMP Sw[], COMP W[], float *prev_Wo);
+
+#endif
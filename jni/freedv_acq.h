@@ -0,0 +1,23 @@
+#ifndef FREEDV_ACQ_H
+#define FREEDV_ACQ_H
+
+/* Samples the pilot detector looks at, the latest ones pushed. */
+#define ACQ_N            512
+
+/* Level of the weaker pilot line, dB above the mean bin, that wakes
+   the demod up. Noise stays below 10 dB. */
+#define ACQ_THRESH_DB    11.5f
+
+/* Frames between detections while idle. */
+#define ACQ_INTERVAL     5
+
+/* Frames out of sync before the demod goes idle. */
+#define ACQ_HOLD         100
+
+/* Called from the receive thread. */
+void acq_reset(void);
+void acq_push(const short x[], int n);
+const short *acq_window(void);
+float acq_pilot_db(void);
+
+#endif /* FREEDV_ACQ_H */
@@ -0,0 +1,353 @@
+/*
+ * Adaptive jitter buffer between the speech decoder and jni_cb().
+ *
+ * Decoded speech arrives a frame at a time whenever the demod has
+ * enough modem samples, and is taken a block at a time as the USB
+ * audio arrives. Each time a block is taken the buffer looks at the
+ * speech queued and at the lag, the modem signal received that the
+ * demod has not turned into speech yet. The lag drifts over a whole
+ * demod frame with the tx/rx clock offset, taking the queue with it,
+ * so it is the queue plus the lag that is steered: to the target
+ * latency plus the mean lag, or higher if need be so that the dips
+ * in the queue, bursts and the highest recent lag, stay clear of an
+ * underrun. With the tx clock slow the lag ramps down and then steps
+ * up a whole demod frame at once, when the demod has to wait for a
+ * frame's worth of samples. The step can be tens of seconds apart,
+ * long after the last one has gone from the highest lag, so while the
+ * clock offset estimate is negative the queue always keeps room for
+ * it:
+ *
+ *   + small errors and the tx/rx clock offset are taken up by the
+ *     resampler all speech goes through. The clock offset estimate
+ *     is fed straight to it. The error is taken up over
+ *     JBUF_TRACK_SECS and adds up to about +/- 1000 ppm on top,
+ *     2000 ppm when the target steps up for a slow tx clock. The
+ *     total is clamped at JBUF_MAX_PPM
+ *   + errors of more than JBUF_TSM_THRESH, e.g. after a burst or a
+ *     change of target, are put right a pitch period at a time by
+ *     time-scale modification of the incoming frame
+ *   + a block that is due when there is not enough speech queued is
+ *     made up by repeating the last pitch period, fading out over
+ *     JBUF_CONCEAL_BLOCKS, and cross faded back into the speech
+ *
+ * All of it runs on the USB thread, the stats are published to a
+ * seqlocked copy as in freedv_rtmon.c.
+ *
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+#include <samplerate.h>
+
+#include "freedv_jbuf.h"
+#include "freedv_rtmon.h"
+#include "sample_ring.h"
+#include "seqlock.h"
+
+#define JBUF_FS              8000    /* sample rate, Hz                          */
+#define JBUF_SIZE            2048    /* queue size, samples                      */
+#define JBUF_MAX_FRAME        320    /* largest frame jbuf_put() takes           */
+#define JBUF_MAX_BLOCK        320    /* largest block jbuf_get() gives           */
+#define JBUF_MAX_TARGET_MS    150
+
+#define JBUF_PMIN              20    /* pitch periods searched, 400 Hz ...       */
+#define JBUF_PMAX             160    /* ... down to 50 Hz                        */
+#define JBUF_HIST    (2*JBUF_PMAX)   /* speech kept for concealment              */
+#define JBUF_XFADE             32    /* cross fade out of concealment, samples   */
+#define JBUF_CONCEAL_BLOCKS     4    /* concealment fades to silence over these  */
+
+#define JBUF_ALPHA    (1.0f/32.0f)   /* weight of a block in the latency mean    */
+#define JBUF_LAG_ALPHA (1.0f/1024.0f) /* and in the mean lag                     */
+#define JBUF_JITTER_DECAY   0.05f    /* samples per block dips are forgotten by  */
+#define JBUF_MARGIN            40    /* kept above an underrun at the lowest dip */
+#define JBUF_TSM_THRESH       160    /* latency error worth a pitch period       */
+#define JBUF_TRACK_SECS       8.0    /* time the resampler takes up an error in  */
+#define JBUF_MAX_PPM       3000.0    /* limit of the resampler correction        */
+#define JBUF_LAG_STEP         160    /* lag step when the demod skips a frame    */
+
+static short              buf[2*JBUF_SIZE];
+static struct sample_ring ring;
+static SRC_STATE         *src;
+
+static float latency;                /* running mean of the queue, samples       */
+static float total;                  /* running mean of the queue plus lag       */
+static float jitter;                 /* deepest recent dip below that            */
+static float lag_mean;
+static float lag_high;               /* highest recent lag                       */
+static float target;                 /* queue plus lag steered to                */
+static float clock_ppm;              /* latest tx/rx clock offset estimate       */
+
+static short hist[JBUF_HIST];        /* last speech delivered                    */
+static short block[JBUF_MAX_BLOCK];
+static int   conceal_n;              /* blocks concealed in a row                */
+static int   conceal_p;              /* period being repeated                    */
+static int   conceal_pos;
+
+static volatile int target_ms = JBUF_DEFAULT_TARGET_MS;
+
+static struct jbuf_stats priv;
+static seqlock_t seq;
+static struct jbuf_stats published;
+
+/*
+ * Pitch period in pmin..pmax, the lag with the best normalised
+ * correlation between x[i] and x[i + dir*p] over i = 0..w-1. Silence
+ * gives pmax.
+ */
+static int best_period(const short x[], int w, int dir, int pmin, int pmax) {
+    float xy, xx, yy, c, best_c = 0.0f;
+    int   p, i, best = pmax;
+
+    for (p = pmin; p <= pmax; p++) {
+        const short *y = x + dir*p;
+
+        xy = xx = yy = 0.0f;
+        for (i = 0; i < w; i++) {
+            xy += (float)x[i]*y[i];
+            xx += (float)x[i]*x[i];
+            yy += (float)y[i]*y[i];
+        }
+        c = xy/sqrtf(xx*yy + 1.0f);
+        if (c > best_c) {
+            best_c = c;
+            best = p;
+        }
+    }
+    return best;
+}
+
+/* Removes a pitch period from x[], returns the new length. */
+static int tsm_compress(short y[], const short x[], int n) {
+    int pmax = n/2 < JBUF_PMAX ? n/2 : JBUF_PMAX;
+    int w = n - pmax, p, i;
+
+    p = best_period(x, w, 1, JBUF_PMIN, pmax);
+    for (i = 0; i < w; i++)
+        y[i] = ((w - i)*x[i] + i*x[i + p])/w;
+    for (; i < n - p; i++)
+        y[i] = x[i + p];
+    return n - p;
+}
+
+/* Repeats a pitch period of x[], returns the new length. */
+static int tsm_stretch(short y[], const short x[], int n) {
+    int pmax = n/2 < JBUF_PMAX ? n/2 : JBUF_PMAX;
+    int w = n - pmax, p, i;
+
+    p = best_period(x, w, 1, JBUF_PMIN, pmax);
+    for (i = 0; i < p; i++)
+        y[i] = x[i];
+    for (i = 0; i < w; i++)
+        y[p + i] = ((w - i)*x[p + i] + i*x[i])/w;
+    for (i = w; i < n; i++)
+        y[p + i] = x[i];
+    return n + p;
+}
+
+/* The next concealment sample, repeating the last period of hist[]. */
+static float conceal_sample(int i, int n) {
+    float g = 1.0f - (float)(conceal_n*n + i)/(JBUF_CONCEAL_BLOCKS*n);
+    float x = hist[JBUF_HIST - conceal_p + conceal_pos];
+
+    conceal_pos = (conceal_pos + 1) % conceal_p;
+    return g > 0.0f ? g*x : 0.0f;
+}
+
+static void hist_push(const short x[], int n) {
+    memmove(hist, &hist[n], (JBUF_HIST - n)*sizeof(short));
+    memcpy(&hist[JBUF_HIST - n], x, n*sizeof(short));
+}
+
+int jbuf_create(void) {
+    int src_error, prime = JBUF_DEFAULT_TARGET_MS*JBUF_FS/1000;
+
+    src = src_new(SRC_SINC_FASTEST, 1, &src_error);
+    if (!src)
+        return 0;
+    sample_ring_init(&ring, buf, JBUF_SIZE);
+    memset(&priv, 0, sizeof(priv));
+    memset(hist, 0, sizeof(hist));
+    conceal_n = 0;
+
+    /* start with the default latency of silence, the resampler's first
+       output is short by its filter delay */
+
+    memset(sample_ring_write_ptr(&ring), 0, prime*sizeof(short));
+    sample_ring_commit(&ring, prime);
+    latency = total = target = prime;
+    clock_ppm = 0.0f;
+    jitter = lag_mean = lag_high = 0.0f;
+    return 1;
+}
+
+void jbuf_destroy(void) {
+    if (src)
+        src_delete(src);
+    src = NULL;
+}
+
+/* Adds a frame of speech decoded at the tx sample clock, clock_offset
+ * ppm fast of ours. */
+void jbuf_put(const short speech[], int n, float clock_offset) {
+    SRC_DATA src_data;
+    short    tsm[JBUF_MAX_FRAME + JBUF_PMAX];
+    float    input[JBUF_MAX_FRAME + JBUF_PMAX];
+    float    output[JBUF_MAX_FRAME + JBUF_PMAX + JBUF_PMAX/4];
+    float    correction;
+    int      m;
+
+    assert(n <= JBUF_MAX_FRAME);
+    clock_ppm = clock_offset;
+
+    /* big errors a pitch period at a time */
+
+    if (total - target > JBUF_TSM_THRESH) {
+        m = tsm_compress(tsm, speech, n);
+        total -= n - m;
+        latency -= n - m;
+        priv.compressed++;
+        speech = tsm;
+        n = m;
+    }
+    else if (target - total > JBUF_TSM_THRESH) {
+        m = tsm_stretch(tsm, speech, n);
+        total += m - n;
+        latency += m - n;
+        priv.stretched++;
+        speech = tsm;
+        n = m;
+    }
+
+    /* the rest, and the clock offset, by resampling */
+
+    correction = -1E-6*clock_offset - (total - target)/(JBUF_TRACK_SECS*JBUF_FS);
+    if (correction > 1E-6*JBUF_MAX_PPM)
+        correction = 1E-6*JBUF_MAX_PPM;
+    if (correction < -1E-6*JBUF_MAX_PPM)
+        correction = -1E-6*JBUF_MAX_PPM;
+    priv.rate_ppm = 1E6*correction;
+
+    if (sample_ring_space(&ring) < sizeof(output)/sizeof(float)) {
+        priv.dropped++;
+        rtmon_overrun();
+        return;
+    }
+
+    src_short_to_float_array(speech, input, n);
+
+    src_data.data_in = input;
+    src_data.data_out = output;
+    src_data.input_frames = n;
+    src_data.output_frames = sizeof(output)/sizeof(float);
+    src_data.end_of_input = 0;
+    src_data.src_ratio = 1.0 + correction;
+
+    src_process(src, &src_data);
+
+    src_float_to_short_array(output, sample_ring_write_ptr(&ring), src_data.output_frames_gen);
+    sample_ring_commit(&ring, src_data.output_frames_gen);
+}
+
+/* The next n samples for the audio sink, concealing if the speech is
+ * late. lag is the modem signal received whose speech is still to
+ * come, in samples. Valid until the next jbuf_put(). */
+const short *jbuf_get(int n, float lag) {
+    const short *p;
+    float queued = sample_ring_avail(&ring);
+    float min_target;
+    int   i, m, t = target_ms;
+
+    assert(n <= JBUF_MAX_BLOCK && n <= JBUF_HIST && n >= JBUF_XFADE);
+
+    priv.blocks++;
+    latency += JBUF_ALPHA*(queued - latency);
+    total += JBUF_ALPHA*(queued + lag - total);
+    if (priv.blocks < 1/JBUF_LAG_ALPHA)
+        lag_mean += (lag - lag_mean)/priv.blocks;
+    else
+        lag_mean += JBUF_LAG_ALPHA*(lag - lag_mean);
+
+    jitter -= JBUF_JITTER_DECAY;
+    if (total - queued - lag > jitter)
+        jitter = total - queued - lag;
+    if (jitter < 0.0f)
+        jitter = 0.0f;
+    lag_high -= JBUF_JITTER_DECAY;
+    if (lag > lag_high)
+        lag_high = lag;
+
+    min_target = n + JBUF_MARGIN + jitter + lag_high;
+    if (clock_ppm < 0.0f && lag + JBUF_LAG_STEP > lag_high)
+        min_target = n + JBUF_MARGIN + jitter + lag + JBUF_LAG_STEP;
+    target = (float)t*JBUF_FS/1000 + lag_mean;
+    if (target < min_target)
+        target = min_target;
+
+    if (queued >= n) {
+        p = sample_ring_read_ptr(&ring);
+        if (conceal_n) {
+            /* cross fade from the concealment back into the speech */
+
+            for (i = 0; i < JBUF_XFADE; i++)
+                block[i] = (i*p[i] + (JBUF_XFADE - i)*conceal_sample(i, n))/JBUF_XFADE;
+            memcpy(&block[JBUF_XFADE], &p[JBUF_XFADE], (n - JBUF_XFADE)*sizeof(short));
+            p = block;
+            conceal_n = 0;
+        }
+        sample_ring_consume(&ring, n);
+        hist_push(p, n);
+    }
+    else {
+        /* play what speech there is, unless already concealing, and
+           make up the rest */
+
+        m = conceal_n ? 0 : queued;
+        memcpy(block, sample_ring_read_ptr(&ring), m*sizeof(short));
+        sample_ring_consume(&ring, m);
+        hist_push(block, m);
+
+        if (conceal_n == 0) {
+            conceal_p = best_period(&hist[JBUF_HIST - JBUF_PMAX], JBUF_PMAX, -1,
+                                    JBUF_PMIN, JBUF_PMAX);
+            conceal_pos = 0;
+        }
+        for (i = m; i < n; i++)
+            block[i] = conceal_sample(i - m, n);
+        conceal_n++;
+        p = block;
+        priv.concealed++;
+        rtmon_underrun();
+    }
+
+    priv.latency_ms = 1000.0f*latency/JBUF_FS;
+    priv.target_ms = 1000.0f*(target - lag_mean)/JBUF_FS;
+    priv.jitter_ms = 1000.0f*(jitter + lag_high - lag_mean)/JBUF_FS;
+
+    seqlock_write_begin(&seq);
+    published = priv;
+    seqlock_write_end(&seq);
+
+    return p;
+}
+
+int jbuf_avail(void) {
+    return sample_ring_avail(&ring);
+}
+
+void jbuf_set_target_ms(int ms) {
+    if (ms < 0)
+        ms = 0;
+    if (ms > JBUF_MAX_TARGET_MS)
+        ms = JBUF_MAX_TARGET_MS;
+    target_ms = ms;
+}
+
+void jbuf_snapshot(struct jbuf_stats *stats) {
+    unsigned int s;
+
+    do {
+        s = seqlock_read_begin(&seq);
+        *stats = published;
+    } while (seqlock_read_retry(&seq, s));
+}
@@ -0,0 +1,33 @@
+#ifndef FREEDV_JBUF_H
+#define FREEDV_JBUF_H
+
+/* Output latency aimed for until jbuf_set_target_ms() says otherwise. */
+#define JBUF_DEFAULT_TARGET_MS 40
+
+struct jbuf_stats {
+    /* speech queued when jni_cb() takes a block, milliseconds */
+    float        latency_ms;         /* running mean                           */
+    float        target_ms;          /* what the latency is steered to         */
+    float        jitter_ms;          /* how far below its mean the queue dips  */
+
+    float        rate_ppm;           /* resampler rate correction              */
+
+    unsigned int blocks;             /* blocks taken by jni_cb()               */
+    unsigned int concealed;          /* blocks made up by pitch repetition     */
+    unsigned int stretched;          /* pitch periods inserted                 */
+    unsigned int compressed;         /* pitch periods removed                  */
+    unsigned int dropped;            /* frames dropped, buffer full            */
+};
+
+/* Called from the receive thread. */
+int jbuf_create(void);
+void jbuf_destroy(void);
+void jbuf_put(const short speech[], int n, float clock_offset);
+const short *jbuf_get(int n, float lag);
+int jbuf_avail(void);
+
+/* Safe to call from any thread, never blocks the receive thread. */
+void jbuf_set_target_ms(int ms);
+void jbuf_snapshot(struct jbuf_stats *stats);
+
+#endif /* FREEDV_JBUF_H */
@@ -12,6 +12,7 @@
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/prctl.h>
 #include <sys/select.h>
 #include <sys/socket.h>
@@ -28,6 +29,8 @@
 
 #include "freedv_usb.h"
 #include "freedv_rx.h"
+#include "freedv_jbuf.h"
+#include "freedv_waterfall.h"
 
 #include "freedv_jni.h"
 
@@ -48,14 +51,19 @@ struct app_ctx {
 
 struct app_ctx *ctx;
 
-bool cb_attached = 0;
 jobject audioPlaybackObj;
 jmethodID AudioPlayback_write;
 jmethodID AudioPlayback_sync;
-jmethodID AudioPlayback_stats;
-jclass AudioPlayback;
 JavaVM* java_vm;
 
+/*
+ * Direct buffer owned by the AudioPlayback object, written here and
+ * read by the write() upcall that follows, so nothing is allocated per
+ * frame.
+ */
+static signed char *audio_buf;
+static jlong audio_buf_len;
+
 static void *usb_thread_entry(void *data) {
     struct app_ctx *ctx = (struct app_ctx *)data;
     LOGD("usb_thread started\n");
@@ -73,112 +81,99 @@ static void *usb_thread_entry(void *data) {
 }
 
 
+/* Address and size of the direct ByteBuffer in the named field. */
+static void *get_direct_buffer(JNIEnv *env, jclass class, jobject obj,
+        const char *name, jlong *len) {
+    jfieldID field;
+    jobject buf;
+
+    field = (*env)->GetFieldID(env, class, name, "Ljava/nio/ByteBuffer;");
+    if (!field) {
+        LOGE("Could not find au.id.jms.freedvdroid.AudioPlayback.%s", name);
+        return NULL;
+    }
+    buf = (*env)->GetObjectField(env, obj, field);
+    if (!buf)
+        return NULL;
+    *len = (*env)->GetDirectBufferCapacity(env, buf);
+    return (*env)->GetDirectBufferAddress(env, buf);
+}
+
 int init_jni_cb(JNIEnv *env, jobject audioPlayback) {
+    jclass AudioPlayback;
+
     // Get write callback handle
-    AudioPlayback = (*env)->FindClass(env,
-            "au/id/jms/freedvdroid/AudioPlayback");
-    if (!AudioPlayback) {
-        LOGE("Could not find au.id.jms.freedvdroid.AudioPlayback");
-        return -1;
-    }
-    // Store ref to audio class instance
-    audioPlaybackObj = (*env)->NewGlobalRef(env, audioPlayback);
+    AudioPlayback = (*env)->GetObjectClass(env, audioPlayback);
     AudioPlayback_write = (*env)->GetMethodID(env, AudioPlayback, "write",
-            "([B)V");
+            "(I)V");
     if (!AudioPlayback_write) {
         LOGE("Could not find au.id.jms.freedvdroid.AudioPlayback.write()");
-        (*env)->DeleteGlobalRef(env, AudioPlayback);
         return -1;
     }
     AudioPlayback_sync = (*env)->GetMethodID(env, AudioPlayback, "sync",
             "(Z)V");
     if (!AudioPlayback_sync) {
         LOGE("Could not find au.id.jms.freedvdroid.AudioPlayback.sync()");
-        (*env)->DeleteGlobalRef(env, AudioPlayback);
         return -1;
     }
-    AudioPlayback_stats = (*env)->GetMethodID(env, AudioPlayback, "stats",
-            "(FF[F[F)V");
-    if (!AudioPlayback_sync) {
-        LOGE("Could not find au.id.jms.freedvdroid.AudioPlayback.stats()");
-        (*env)->DeleteGlobalRef(env, AudioPlayback);
+
+    // The buffer lives as long as the object, which we keep a ref to
+    audio_buf = get_direct_buffer(env, AudioPlayback, audioPlayback,
+            "mAudioBuf", &audio_buf_len);
+    if (!audio_buf) {
+        LOGE("AudioPlayback buffer missing");
         return -1;
     }
-    cb_attached = false;
+
+    // Store ref to audio class instance
+    audioPlaybackObj = (*env)->NewGlobalRef(env, audioPlayback);
     return 0;
 }
 
+/* Thread key destructor, detaches a thread from the VM as it exits. */
 static void destroy_jni_cb(void* data) {
     if (data != NULL) {
         (*java_vm)->DetachCurrentThread(java_vm);
-        pthread_setspecific(ctx->env_key, NULL);
         LOGD("Detached jni_cb thread");
     }
 }
 
-void jni_cb(const signed char *data, int len) {
-    JNIEnv *env;
-    if (cb_attached == false) {
-        (*java_vm)->AttachCurrentThread(java_vm, &env, NULL);
+/* The JNIEnv of the calling thread, attaching it to the VM the first
+ * time only. */
+static JNIEnv *jni_env(void) {
+    JNIEnv *env = pthread_getspecific(ctx->env_key);
+
+    if (env == NULL) {
+        if ((*java_vm)->AttachCurrentThread(java_vm, &env, NULL) != JNI_OK) {
+            LOGE("Could not attach jni_cb thread");
+            return NULL;
+        }
         pthread_setspecific(ctx->env_key, (void *)env);
-    } else {
-        env = pthread_getspecific(ctx->env_key);
+        LOGD("Attached jni_cb thread");
     }
+    return env;
+}
 
-    jbyteArray dataArray = (*env)->NewByteArray(env, len);
-    (*env)->SetByteArrayRegion(env, dataArray, 0, len, data);
-    (*env)->CallVoidMethod(env, audioPlaybackObj, AudioPlayback_write,
-            dataArray);
-    (*env)->DeleteLocalRef(env, dataArray);
+void jni_cb(const signed char *data, int len) {
+    JNIEnv *env = jni_env();
+
+    if (env == NULL)
+        return;
+    if (len > audio_buf_len)
+        len = audio_buf_len;
+    memcpy(audio_buf, data, len);
+    (*env)->CallVoidMethod(env, audioPlaybackObj, AudioPlayback_write, len);
 }
 
 void jni_update_sync(bool state) {
-    JNIEnv *env;
-    if (cb_attached == false) {
-        (*java_vm)->AttachCurrentThread(java_vm, &env, NULL);
-        pthread_setspecific(ctx->env_key, (void *)env);
-    } else {
-        env = pthread_getspecific(ctx->env_key);
-    }
+    JNIEnv *env = jni_env();
+
+    if (env == NULL)
+        return;
     (*env)->CallVoidMethod(env, audioPlaybackObj, AudioPlayback_sync, state);
 }
 
 
-void jni_update_stats(const struct FDMDV_STATS *stats, const float *spectrum) {
-    JNIEnv *env;
-    if (cb_attached == false) {
-        (*java_vm)->AttachCurrentThread(java_vm, &env, NULL);
-        pthread_setspecific(ctx->env_key, (void *)env);
-    } else {
-        env = pthread_getspecific(ctx->env_key);
-    }
-
-    /* FDMDV_STATS structure:
-     * float snr_est - estimated SNR of rx signal in dB (3 kHz noise BW)
-     * COMP rx_symbols[FDMDV_NSYM] - latest received symbols, for scatter plot 
-     * int fest_coarse_fine - freq est state, 0-coarse 1-fine
-     * float foff - estimated freq offset in Hz
-     * float rx_timing - estimated optimum timing offset in samples
-     * float clock_offset - Estimated tx/rx sample clock offset in ppm
-    */
-
-    /* Should size be the number of floats, or number of bytes? */
-    /* Using numbero f floats. COMP is two floats big. */
-    jfloatArray symbolArray = (*env)->NewFloatArray(env, 2*FDMDV_NSYM);
-    (*env)->SetFloatArrayRegion(env, symbolArray, 0, 2*FDMDV_NSYM,
-            (float *)stats->rx_symbols);
-
-    jfloatArray specArray = (*env)->NewFloatArray(env, FDMDV_NSPEC);
-    (*env)->SetFloatArrayRegion(env, specArray, 0, FDMDV_NSPEC, spectrum);
-
-    (*env)->CallVoidMethod(env, audioPlaybackObj, AudioPlayback_stats,
-            stats->foff, stats->rx_timing/FDMDV_NOM_SAMPLES_PER_FRAME,
-            symbolArray, specArray);
-
-    (*env)->DeleteLocalRef(env, symbolArray);
-    (*env)->DeleteLocalRef(env, specArray);
-}
-
 
 JNIEXPORT jboolean JNICALL
 Java_au_id_jms_freedvdroid_Freedv_setup(JNIEnv *env, jclass class,
@@ -238,10 +233,10 @@ JNIEXPORT jboolean JNICALL
 Java_au_id_jms_freedvdroid_Freedv_close(JNIEnv *env, jclass class) {
     // Stop thread
     ctx->usb_thread_run = false;
-    cb_attached = false;
     if (pthread_join(ctx->usb_thread, NULL) < 0) {
         LOGE("Could not join usb_thread");
     }
+    pthread_key_delete(ctx->env_key);
     // Destroy JNI global references
     (*env)->DeleteGlobalRef(env, audioPlaybackObj);
     // Cleanup the rest
@@ -253,6 +248,133 @@ Java_au_id_jms_freedvdroid_Freedv_close(JNIEnv *env, jclass class) {
 }
 
 
+/* Text decoded from the data bit since the last call, polled by the UI. */
+JNIEXPORT jstring JNICALL
+Java_au_id_jms_freedvdroid_Freedv_getText(JNIEnv *env, jclass class) {
+    char text[256 + 1];
+    int n, i, j;
+
+    n = rx_get_text(text, sizeof(text) - 1);
+
+    /* The text is 7 bit ASCII, so valid modified UTF-8 once any NULs
+     * are removed. */
+    for (i = j = 0; i < n; i++)
+        if (text[i])
+            text[j++] = text[i];
+    text[j] = 0;
+
+    return (*env)->NewStringUTF(env, text);
+}
+
+
+/* Latest demod telemetry into an FdmdvStats, polled by the UI at its
+ * own rate. Copies into the object's arrays, nothing is allocated. */
+JNIEXPORT void JNICALL
+Java_au_id_jms_freedvdroid_Freedv_getStats(JNIEnv *env, jclass class UNUSED,
+        jobject stats) {
+    struct rx_telemetry t;
+    jclass FdmdvStats = (*env)->GetObjectClass(env, stats);
+    jfieldID field;
+    jfloatArray array;
+
+    rx_telemetry_snapshot(&t);
+
+    field = (*env)->GetFieldID(env, FdmdvStats, "frames", "I");
+    (*env)->SetIntField(env, stats, field, t.frames);
+    field = (*env)->GetFieldID(env, FdmdvStats, "sync", "Z");
+    (*env)->SetBooleanField(env, stats, field, t.sync);
+    field = (*env)->GetFieldID(env, FdmdvStats, "snrEstDb", "F");
+    (*env)->SetFloatField(env, stats, field, t.snr_est);
+    field = (*env)->GetFieldID(env, FdmdvStats, "freqOffEstHz", "F");
+    (*env)->SetFloatField(env, stats, field, t.foff);
+    field = (*env)->GetFieldID(env, FdmdvStats, "rxTimingEstSamples", "F");
+    (*env)->SetFloatField(env, stats, field,
+            t.rx_timing/FDMDV_NOM_SAMPLES_PER_FRAME);
+    field = (*env)->GetFieldID(env, FdmdvStats, "clockOffsetPpm", "F");
+    (*env)->SetFloatField(env, stats, field, t.clock_offset);
+
+    /* COMP is two floats big. */
+    field = (*env)->GetFieldID(env, FdmdvStats, "rxSymbols", "[F");
+    array = (*env)->GetObjectField(env, stats, field);
+    (*env)->SetFloatArrayRegion(env, array, 0, 2*FDMDV_NSYM,
+            (float *)t.rx_symbols);
+    (*env)->DeleteLocalRef(env, array);
+    field = (*env)->GetFieldID(env, FdmdvStats, "avgSpectrum", "[F");
+    array = (*env)->GetObjectField(env, stats, field);
+    (*env)->SetFloatArrayRegion(env, array, 0, FDMDV_NSPEC, t.spectrum);
+    (*env)->DeleteLocalRef(env, array);
+
+    (*env)->DeleteLocalRef(env, FdmdvStats);
+}
+
+
+/* The waterfall ring, mapped once after setup(). Only valid until
+ * close(), the UI must drop it then. */
+JNIEXPORT jobject JNICALL
+Java_au_id_jms_freedvdroid_Freedv_getWaterfall(JNIEnv *env, jclass class UNUSED) {
+    int rows;
+    uint32_t *pixels = waterfall_pixels(&rows);
+
+    if (!pixels)
+        return NULL;
+    return (*env)->NewDirectByteBuffer(env, pixels,
+            (jlong)2*rows*WATERFALL_WIDTH*sizeof(uint32_t));
+}
+
+JNIEXPORT jint JNICALL
+Java_au_id_jms_freedvdroid_Freedv_waterfallRows(JNIEnv *env UNUSED,
+        jclass class UNUSED) {
+    int rows;
+
+    waterfall_pixels(&rows);
+    return rows;
+}
+
+/* Byte offset in the getWaterfall() buffer of the current image, the
+ * newest row first. */
+JNIEXPORT jint JNICALL
+Java_au_id_jms_freedvdroid_Freedv_waterfallOffset(JNIEnv *env UNUSED,
+        jclass class UNUSED) {
+    const uint32_t *image = waterfall_image(NULL);
+    uint32_t *pixels = waterfall_pixels(NULL);
+
+    if (!image)
+        return 0;
+    return (image - pixels)*sizeof(uint32_t);
+}
+
+JNIEXPORT void JNICALL
+Java_au_id_jms_freedvdroid_Freedv_setWaterfallRate(JNIEnv *env UNUSED,
+        jclass class UNUSED, jfloat rows_per_sec) {
+    waterfall_set_rate(rows_per_sec);
+}
+
+
+/* Output latency to aim for, the jitter buffer still adds what it needs
+ * to ride out the arrival jitter. */
+JNIEXPORT void JNICALL
+Java_au_id_jms_freedvdroid_Freedv_setLatency(JNIEnv *env UNUSED, jclass class UNUSED,
+                                             jint ms) {
+    jbuf_set_target_ms(ms);
+}
+
+/* Whether the demod may sleep on an empty channel until a pilot shows
+ * up, on by default. */
+JNIEXPORT void JNICALL
+Java_au_id_jms_freedvdroid_Freedv_setLowPower(JNIEnv *env UNUSED, jclass class UNUSED,
+                                              jboolean enable) {
+    rx_set_low_power(enable);
+}
+
+/* How long the demod holds its sync through a fade, see
+ * rx_set_fade_hold_ms(). */
+JNIEXPORT void JNICALL
+Java_au_id_jms_freedvdroid_Freedv_setFadeHold(JNIEnv *env UNUSED, jclass class UNUSED,
+                                              jint ms) {
+    rx_set_fade_hold_ms(ms);
+}
+
+
 JNIEXPORT jint JNICALL
 JNI_OnLoad(JavaVM* vm, void* reserved UNUSED)
 {
@@ -0,0 +1,143 @@
+/*
+ * Real time deadline and jitter monitor for the receive path.
+ *
+ * All the rtmon_* event hooks run on the USB thread. They update
+ * private counters, and at the end of each rx_decode_buffer() the
+ * counters are published to a seqlocked copy so other threads can take
+ * a consistent snapshot without ever blocking the audio path.
+ *
+ */
+
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+
+#include "seqlock.h"
+#include "freedv_rtmon.h"
+
+/* Weight of a new sample in the running means and jitter estimate. */
+#define RTMON_ALPHA (1.0f/16.0f)
+
+/* Deliveries more than this far apart count as a late frame. */
+#define RTMON_LATE_US (RTMON_FRAME_US + RTMON_FRAME_US/2)
+
+static struct rtmon_stats priv;
+static uint64_t last_cb_us;
+static uint64_t decode_start_us;
+static uint64_t last_delivery_us;
+static unsigned int decodes;
+
+static seqlock_t seq;
+static struct rtmon_stats published;
+static volatile int reset_pending;
+
+static uint64_t now_us(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000 + ts.tv_nsec/1000;
+}
+
+static float running_mean(float mean, float x, unsigned int n) {
+    /* Plain mean until we have enough samples, then exponential. */
+    if (n <= 1)
+        return x;
+    if (n < 1/RTMON_ALPHA)
+        return mean + (x - mean)/n;
+    return mean + RTMON_ALPHA*(x - mean);
+}
+
+static void clear(void) {
+    memset(&priv, 0, sizeof(priv));
+    last_cb_us = 0;
+    last_delivery_us = 0;
+    decodes = 0;
+}
+
+void rtmon_transfer_cb(void) {
+    uint64_t now = now_us();
+    float interval, dev;
+
+    priv.callbacks++;
+    if (last_cb_us) {
+        interval = now - last_cb_us;
+        priv.cb_interval_mean_us = running_mean(priv.cb_interval_mean_us,
+                interval, priv.callbacks - 1);
+        if (interval > priv.cb_interval_max_us)
+            priv.cb_interval_max_us = interval;
+
+        /* RFC 3550 style interarrival jitter */
+        dev = interval - RTMON_FRAME_US;
+        if (dev < 0)
+            dev = -dev;
+        priv.cb_jitter_us += RTMON_ALPHA*(dev - priv.cb_jitter_us);
+    }
+    last_cb_us = now;
+}
+
+void rtmon_decode_begin(void) {
+    decode_start_us = now_us();
+}
+
+void rtmon_decode_end(int queue_depth) {
+    float t = now_us() - decode_start_us;
+
+    if (reset_pending) {
+        clear();
+        reset_pending = 0;
+    }
+
+    decodes++;
+    priv.decode_mean_us = running_mean(priv.decode_mean_us, t, decodes);
+    if (t > priv.decode_max_us)
+        priv.decode_max_us = t;
+    if (t > RTMON_FRAME_US)
+        priv.deadline_misses++;
+
+    priv.queue_depth = queue_depth;
+    if (queue_depth > priv.queue_depth_max)
+        priv.queue_depth_max = queue_depth;
+    if (queue_depth < priv.queue_depth_min || decodes == 1)
+        priv.queue_depth_min = queue_depth;
+
+    seqlock_write_begin(&seq);
+    published = priv;
+    seqlock_write_end(&seq);
+}
+
+void rtmon_delivered(void) {
+    uint64_t now = now_us();
+    float gap;
+
+    priv.deliveries++;
+    if (last_delivery_us) {
+        gap = now - last_delivery_us;
+        if (gap > priv.delivery_gap_max_us)
+            priv.delivery_gap_max_us = gap;
+        if (gap > RTMON_LATE_US)
+            priv.late_frames++;
+    }
+    last_delivery_us = now;
+}
+
+void rtmon_overrun(void) {
+    priv.overruns++;
+}
+
+void rtmon_underrun(void) {
+    priv.underruns++;
+}
+
+void rtmon_snapshot(struct rtmon_stats *stats) {
+    unsigned int s;
+
+    do {
+        s = seqlock_read_begin(&seq);
+        *stats = published;
+    } while (seqlock_read_retry(&seq, s));
+}
+
+void rtmon_reset(void) {
+    /* The counters belong to the USB thread, let it do the clearing. */
+    reset_pending = 1;
+}
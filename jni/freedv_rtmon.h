@@ -0,0 +1,45 @@
+#ifndef FREEDV_RTMON_H
+#define FREEDV_RTMON_H
+
+/* Frame clock the receive path has to keep up with. */
+#define RTMON_FRAME_US 20000
+
+struct rtmon_stats {
+    /* USB transfer callback arrival, microseconds */
+    float        cb_interval_mean_us;
+    float        cb_interval_max_us;
+    float        cb_jitter_us;       /* mean deviation from RTMON_FRAME_US */
+
+    /* time spent in rx_decode_buffer(), microseconds */
+    float        decode_mean_us;
+    float        decode_max_us;
+
+    /* decoded audio waiting to be delivered, samples */
+    int          queue_depth;
+    int          queue_depth_min;
+    int          queue_depth_max;
+
+    /* largest gap between two jni_cb() deliveries, microseconds */
+    float        delivery_gap_max_us;
+
+    unsigned int callbacks;
+    unsigned int deliveries;
+    unsigned int overruns;           /* decoded frames dropped, queue full  */
+    unsigned int underruns;          /* callbacks with nothing to deliver   */
+    unsigned int late_frames;        /* delivery gap over 1.5 frames        */
+    unsigned int deadline_misses;    /* decode took longer than a frame     */
+};
+
+/* Called from the receive thread. */
+void rtmon_transfer_cb(void);
+void rtmon_decode_begin(void);
+void rtmon_decode_end(int queue_depth);
+void rtmon_delivered(void);
+void rtmon_overrun(void);
+void rtmon_underrun(void);
+
+/* Safe to call from any thread, never blocks the receive thread. */
+void rtmon_snapshot(struct rtmon_stats *stats);
+void rtmon_reset(void);
+
+#endif /* FREEDV_RTMON_H */
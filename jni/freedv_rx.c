@@ -20,13 +20,28 @@
 #include <codec2.h>
 #include <varicode.h>
 
+#include "freedv_acq.h"
 #include "freedv_jni.h"
-
+#include "freedv_jbuf.h"
+#include "freedv_rtmon.h"
+#include "freedv_rx.h"
+#include "freedv_waterfall.h"
+#include "sample_ring.h"
+#include "seqlock.h"
+#include "spsc_ring.h"
+
+#ifdef __ANDROID__
 #include <android/log.h>
 #define LOGD(...) \
         __android_log_print(ANDROID_LOG_DEBUG, "FreedvRxNative", __VA_ARGS__)
 #define LOGE(...) \
         __android_log_print(ANDROID_LOG_ERROR, "FreedvRxNative", __VA_ARGS__)
+#else
+/* Host build (jni/bench), the jni_* callbacks are supplied by the
+ * benchmark. */
+#define LOGD(...) fprintf(stderr, __VA_ARGS__)
+#define LOGE(...) fprintf(stderr, __VA_ARGS__)
+#endif
 
 #define MIN_DB             -40.0 
 #define MAX_DB               0.0
@@ -60,6 +75,9 @@
 #define NUM_CHANNELS 2                            /* I think most sound cards prefer stereo,
                                                      we will convert to mono                 */
 
+#define TEXT_RING_SIZE     256    // decoded text waiting for rx_get_text()
+#define IN_RING_SIZE      1024    // 8 kHz modem samples waiting for the demod
+
 #define BITS_PER_CODEC_FRAME (2*FDMDV_BITS_PER_FRAME)
 #define BYTES_PER_CODEC_FRAME (BITS_PER_CODEC_FRAME/8)
 
@@ -79,19 +97,37 @@ float g_avmag[FDMDV_NSPEC];
 struct FDMDV_STATS stats;
 int count;
 struct VARICODE_DEC  g_varicode_dec_states;
+unsigned char        g_text_buf[TEXT_RING_SIZE];
+struct spsc_ring     g_text_ring;
+seqlock_t            g_telemetry_seq;
+struct rx_telemetry  g_telemetry;     // read with rx_telemetry_snapshot()
 
 pthread_mutex_t mutex;
 
 // Main processing loop states ------------------
 
-short  input_buf[2*FDMDV_NOM_SAMPLES_PER_FRAME];
-int    n_input_buf = 0;
+short  g_in_buf[2*IN_RING_SIZE];
+struct sample_ring g_in_ring;
 int    g_nin = FDMDV_NOM_SAMPLES_PER_FRAME;
-short *output_buf;
-int    n_output_buf = 0;
-int    codec_bits[2*FDMDV_BITS_PER_FRAME];
+int    g_out_due = 0;             // 8 kHz samples of output owed to jni_cb()
+unsigned char codec_bits[BYTES_PER_CODEC_FRAME];
 int    g_state = 0;
 
+// Low power acquisition, see idle_frame()
+
+volatile int g_low_power = 1;
+int    g_idle = 0;                // demod off until the pilot shows up
+int    g_idle_frames = 0;
+int    g_unsync_frames = 0;       // frames in state 0 since the last sync
+float  g_pilot_db = 0.0;
+
+// Fade hold, see fdmdv_set_fade_hold()
+
+#define FRAME_MS     (1000*N8/FS)
+
+volatile int g_fade_hold_frames = RX_DEFAULT_FADE_HOLD_MS/FRAME_MS;
+int    g_fade_hold_set = -1;      // g_fade_hold_frames the demod was last given
+
 /*------------------------------------------------------------------*\
 
   FUNCTION: per_frame_rx_processing()
@@ -115,96 +151,168 @@ int    g_state = 0;
     decode bits into speech samples
     output a buffer of speech samples to sound card 2 D/A
 
+  The bits stay packed from the demod to the decoder, each demod
+  frame is written straight into its half of codec_bits[].  The
+  modem samples are held in a sample ring the demod reads from in
+  place, the decoded speech goes to the jitter buffer.
+
   Note that sound card 1 and sound card 2 will have slightly different
   sample rates, as their sample clocks are not syncronised.  We
   effectively lock the system to the demod A/D (sound card 1) sample
   rate. This ensures the demod gets a continuous sequence of samples,
-  maintaining sync. Sample underflow or overflow will instead occur on
-  the sound card 2 D/A.  This is acceptable as a buffer of lost or
-  extra speech samples is unlikely to be noticed.
+  maintaining sync.  The output to sound card 2 is owed at the same
+  rate, one N8 block for every N8 modem samples received.
 
   The situation is actually a little more complex than that.  Through
-  the demod timing estimation the buffers supplied to sound card D/A 2
-  are effectively clocked at the remote modulator sound card D/A clock
-  rate.  We slip/gain buffers supplied to sound card 2 to compensate.
-
-  The current demod handles varying clock rates by having a variable
-  number of input samples, e.g. 120 160 (nominal) or 200.  However the
-  A/D always delivers a fixed number of samples.
-
-  So we currently need some logic between the A/D and the demod:
-    + A/D delivers fixed number of samples
-    + demod processes a variable number of samples
-    + this means we run demod 0,1 or 2 times, depending 
-      on number of buffered A/D samples
-    + demod always outputs 1 frame of bits
-    + so run demod and speech decoder 0, 1 or 2 times
+  the demod timing estimation the decoded speech is effectively
+  clocked at the remote modulator sound card D/A clock rate.  Rather
+  than slip/gain whole buffers to compensate, the jitter buffer
+  (freedv_jbuf.c) resamples the speech to track the demod's estimate
+  of the tx/rx clock offset, and holds the output latency at its
+  target.
+
+  The demod handles varying clock rates by taking a variable number
+  of input samples each frame, nin, e.g. 120, 160 (nominal) or 200.
+  rx_decode_buffer() accepts any number of samples per call, so the
+  A/D and the demod are decoupled by the input sample ring:
+    + rx_decode_buffer() resamples whatever it is given to 8 kHz and
+      appends it to the ring
+    + the demod runs as long as the ring holds nin samples, once per
+      nin, so 0 or more times per call depending on the call size and
+      what was left over from the last one
+    + demod always outputs 1 frame of bits, every 2nd frame a frame
+      of speech goes to the jitter buffer
   
   The ouput of the demod is codec voice data so it's OK if we miss or
   repeat a frame every now and again.
 
-  TODOs:
+\*------------------------------------------------------------------*/
 
-    + this might work with arbitrary input and output buffer lengths,
-    0,1, or 2 only apply if we are inputting the nominal number of
-    samples on every call.
+/* Copies this frame's demod stats and spectrum where the UI can poll
+   them at its own rate, see rx_telemetry_snapshot(). */
 
-    + so the I/O buffer sizes might not matter, as long as they of
-    reasonable size (say twice the nominal size).
+static void publish_telemetry(void)
+{
+    seqlock_write_begin(&g_telemetry_seq);
+    g_telemetry.frames = count;
+    g_telemetry.sync = g_state != 0;
+    g_telemetry.idle = g_idle;
+    g_telemetry.pilot_db = g_pilot_db;
+    g_telemetry.snr_est = stats.snr_est;
+    g_telemetry.foff = stats.foff;
+    g_telemetry.rx_timing = stats.rx_timing;
+    g_telemetry.clock_offset = stats.clock_offset;
+    memcpy(g_telemetry.rx_symbols, stats.rx_symbols, sizeof(stats.rx_symbols));
+    memcpy(g_telemetry.spectrum, g_avmag, sizeof(g_avmag));
+    seqlock_write_end(&g_telemetry_seq);
+}
 
-\*------------------------------------------------------------------*/
+/* Silence for the n modem samples of frames with no speech, keeps the
+   speech in step with the modem signal. */
+
+static void put_silence(int n)
+{
+    short zeros[FDMDV_MAX_SAMPLES_PER_FRAME];
+
+    memset(zeros, 0, sizeof(zeros));
+    jbuf_put(zeros, n, 0.0);
+}
+
+/* Low power acquisition mode.  Out of sync with no pilot in sight the
+   demod, the spectrum and the stats are skipped, each frame just goes
+   into the pilot detector's history.  Every ACQ_INTERVAL frames the
+   detector looks at the latest ACQ_N samples, and the spectrum and
+   waterfall are updated from the same window so the display still
+   shows what is on the channel.  Returns 0 once the pilot is seen,
+   leaving the frame in the ring for the demod. */
 
-void per_frame_rx_processing(short  output_buf[], /* output buf of decoded speech samples          */
-                             int   *n_output_buf, /* how many samples currently in output_buf[]    */
-                             int    codec_bits[], /* current frame of bits for decoder             */
-                             short  input_buf[],  /* input buf of modem samples input to demod     */ 
-                             int   *n_input_buf   /* how many samples currently in input_buf[]     */
+static int idle_frame(struct sample_ring *in)
+{
+    const short *x = sample_ring_read_ptr(in);
+    COMP   window[ACQ_N];
+    float  rx_spec[FDMDV_NSPEC];
+    int    i;
+
+    if (!g_low_power) {
+        g_idle = 0;
+        return 0;
+    }
+
+    acq_push(x, N8);
+    if (++g_idle_frames % ACQ_INTERVAL == 0) {
+        g_pilot_db = acq_pilot_db();
+        if (g_pilot_db > ACQ_THRESH_DB) {
+            g_idle = 0;
+            g_unsync_frames = 0;
+            return 0;
+        }
+
+        x = acq_window();
+        for(i=0; i<ACQ_N; i++) {
+            window[i].real = (float)x[i]/FDMDV_SCALE;
+            window[i].imag = 0.0;
+        }
+        fdmdv_get_rx_spectrum(fdmdv, rx_spec, window, ACQ_N);
+        for(i = 0; i < FDMDV_NSPEC; i++)
+            g_avmag[i] = BETA * g_avmag[i] + (1.0 - BETA) * rx_spec[i];
+        waterfall_update(g_avmag, (float)ACQ_INTERVAL*N8/FS);
+    }
+
+    sample_ring_consume(in, N8);
+    put_silence(N8);
+    count++;
+    if (g_idle_frames % ACQ_INTERVAL == 0)
+        publish_telemetry();
+    return 1;
+}
+
+void per_frame_rx_processing(unsigned char codec_bits[], /* current packed frame for decoder   */
+                             struct sample_ring *in   /* modem samples input to demod     */
                              )
 {
     int    sync_bit;
     COMP  rx_fdm[FDMDV_MAX_SAMPLES_PER_FRAME];
-    int    rx_bits[FDMDV_BITS_PER_FRAME];
-    unsigned char  packed_bits[BYTES_PER_CODEC_FRAME];
     float  rx_spec[FDMDV_NSPEC];
-    int    i, nin_prev, bit, byte;
+    const short *in8k;
+    short  speech[2*N8];
+    int    i, nin_prev, nbit;
     int    next_state;
-
-    assert(*n_input_buf <= (2*FDMDV_NOM_SAMPLES_PER_FRAME));
+    int    spf = codec2_samples_per_frame(codec2);
 
     /*
-      This while loop will run the demod 0, 1 (nominal) or 2 times:
-
-      0: when tx sample clock runs faster than rx, occasionally we
-         will run out of samples
-
-      1: normal, run decoder once, every 2nd frame output a frame of
-         speech samples to D/A
+      Run the demod for every nin samples in the ring.  When the tx
+      sample clock runs faster than rx nin shrinks now and then, and
+      when it runs slower nin grows, so over time the number of
+      frames tracks the tx clock.  Whatever is left over waits for
+      the next call.
+    */
 
-      2: when tx sample clock runs slower than rx, occasionally we will
-         have enough samples to run demod twice.
+    while(sample_ring_avail(in) >= g_nin) {
 
-      With a +/- 10 Hz sample clock difference at FS=8000Hz (+/- 1250
-      ppm), case 0 or 1 occured about once every 30 seconds.  This is
-      no problem for the decoded audio.
-    */
+        if (g_idle && idle_frame(in))
+            continue;
 
-    while(*n_input_buf >= g_nin) {
+        if (g_fade_hold_set != g_fade_hold_frames) {
+            g_fade_hold_set = g_fade_hold_frames;
+            fdmdv_set_fade_hold(fdmdv, g_fade_hold_set);
+        }
 
         // demod per frame processing
 
+        in8k = sample_ring_read_ptr(in);
         for(i=0; i<g_nin; i++) {
-            rx_fdm[i].real = (float)input_buf[i]/FDMDV_SCALE;
+            rx_fdm[i].real = (float)in8k[i]/FDMDV_SCALE;
             rx_fdm[i].imag = 0.0;
         }
         nin_prev = g_nin;
-        fdmdv_demod(fdmdv, rx_bits, &sync_bit, rx_fdm, &g_nin);
-        *n_input_buf -= nin_prev;
-        assert(*n_input_buf >= 0);
 
-        // shift input buffer
+        /* demod into the half of the codec frame this state expects,
+           a frame that turns out to be out of sequence is overwritten
+           later */
 
-        for(i=0; i<*n_input_buf; i++)
-            input_buf[i] = input_buf[i+nin_prev];
+        nbit = (g_state == 2) ? FDMDV_BITS_PER_FRAME : 0;
+        fdmdv_demod_packed(fdmdv, codec_bits, nbit, &sync_bit, rx_fdm, &g_nin);
+        sample_ring_consume(in, nin_prev);
 
         // compute rx spectrum & get demod stats, and update GUI plot data
 
@@ -215,9 +323,9 @@ void per_frame_rx_processing(short  output_buf[], /* output buf of decoded speec
         {
             g_avmag[i] = BETA * g_avmag[i] + (1.0 - BETA) * rx_spec[i];
         }
+        waterfall_update(g_avmag, (float)nin_prev/FS);
 
         fdmdv_get_demod_stats(fdmdv, &stats);
-        jni_update_stats(&stats, g_avmag);
         count++;
 
         /* 
@@ -237,14 +345,7 @@ void per_frame_rx_processing(short  output_buf[], /* output buf of decoded speec
         case 0:
             /* mute output audio when out of sync */
 
-            if (*n_output_buf < 2*codec2_samples_per_frame(codec2) - N8) {
-                for(i=0; i<N8; i++)
-                    output_buf[*n_output_buf + i] = 0;
-                *n_output_buf += N8;
-            }
-            if (!(*n_output_buf <= (2*codec2_samples_per_frame(codec2)))) {
-                LOGE("*n_output_buf <= (2*codec2_samples_per_frame(codec2))");
-            }
+            put_silence(nin_prev);
 
             if ((stats.fest_coarse_fine == 1))// && (stats.snr_est > 3.0))
                 next_state = 1;
@@ -252,11 +353,9 @@ void per_frame_rx_processing(short  output_buf[], /* output buf of decoded speec
             break;
         case 1:
             if (sync_bit == 0) {
-                next_state = 2;
-
-                /* first half of frame of codec bits */
+                /* first half of frame of codec bits, already in place */
 
-                memcpy(codec_bits, rx_bits, FDMDV_BITS_PER_FRAME*sizeof(int));
+                next_state = 2;
             }
             else
                 next_state = 1;
@@ -264,6 +363,11 @@ void per_frame_rx_processing(short  output_buf[], /* output buf of decoded speec
             if (stats.fest_coarse_fine == 0)
                 next_state = 0;
 
+            /* no speech unless this frame starts a codec frame */
+
+            if (next_state != 2)
+                put_silence(nin_prev);
+
             break;
         case 2:
             next_state = 1;
@@ -272,53 +376,39 @@ void per_frame_rx_processing(short  output_buf[], /* output buf of decoded speec
                 next_state = 0;
 
             if (sync_bit == 1) {
-                /* second half of frame of codec bits */
-
-                memcpy(&codec_bits[FDMDV_BITS_PER_FRAME], rx_bits,
-                        FDMDV_BITS_PER_FRAME*sizeof(int));
+                /* second half of frame of codec bits, already in place */
 
                 // extract data bit
 
-                int data_flag_index = codec2_get_spare_bit_index(codec2);
-                assert(data_flag_index != -1); // not supported for all rates
+                int data_bit = codec2_get_spare_bit(codec2, codec_bits);
+                assert(data_bit != -1); // not supported for all rates
 
-                short abit = codec_bits[data_flag_index];
+                short abit = data_bit;
                 char  ascii_out;
 
                 int n_ascii = varicode_decode(&g_varicode_dec_states,
                         &ascii_out, &abit, 1, 1);
                 assert((n_ascii == 0) || (n_ascii == 1));
                 if (n_ascii) {
-                    short ashort = ascii_out;
-                    LOGD("%c", ashort);
+                    /* dropped if the reader has fallen behind */
+                    spsc_ring_write(&g_text_ring, &ascii_out, 1);
                 }
 
                 // reconstruct missing bit we steal for data bit and decode
                 // speech
-                codec2_rebuild_spare_bit(codec2, codec_bits);
-
-                /* pack bits, MSB received first  */
-
-                bit = 7; byte = 0;
-                memset(packed_bits, 0, BYTES_PER_CODEC_FRAME);
-                for(i=0; i<BITS_PER_CODEC_FRAME; i++) {
-                    packed_bits[byte] |= (codec_bits[i] << bit);
-                    bit--;
-                    if (bit < 0) {
-                        bit = 7;
-                        byte++;
-                    }
-                }
-                assert(byte == BYTES_PER_CODEC_FRAME);
+                codec2_rebuild_spare_bit_packed(codec2, codec_bits);
 
                 /* add decoded speech to end of output buffer */
 
-                if (*n_output_buf <= codec2_samples_per_frame(codec2)) {
-                    codec2_decode(codec2, &output_buf[*n_output_buf], packed_bits);
-                    *n_output_buf += codec2_samples_per_frame(codec2);
-                }
-                assert(*n_output_buf <= (2*codec2_samples_per_frame(codec2)));
+                codec2_decode(codec2, speech, codec_bits);
+                jbuf_put(speech, spf, stats.clock_offset);
+
+            }
+            else {
+                /* out of sequence, the first half and this frame are lost */
 
+                put_silence(N8);
+                put_silence(nin_prev);
             }
             break;
         }
@@ -326,6 +416,22 @@ void per_frame_rx_processing(short  output_buf[], /* output buf of decoded speec
             jni_update_sync(g_state == 0);
         }
         g_state = next_state;
+
+        /* nothing decoded for a while, go back to waiting for a pilot,
+           from which the demod starts a fresh acquisition */
+
+        if (g_state == 0)
+            g_unsync_frames++;
+        else
+            g_unsync_frames = 0;
+        if (g_low_power && g_unsync_frames >= ACQ_HOLD) {
+            g_idle = 1;
+            g_idle_frames = 0;
+            g_nin = N8;
+            fdmdv_end_fade_hold(fdmdv);
+        }
+
+        publish_telemetry();
     }
 }
 
@@ -363,45 +469,89 @@ int resample_48k_to_8k(
     return src_data.output_frames_gen;
 }
 
+/* Decoded text since the last call, up to max characters. Never blocks
+ * the receive thread, call from one thread at a time. */
+int rx_get_text(char *text, int max) {
+    return spsc_ring_read(&g_text_ring, text, max);
+}
+
+/* Enables or disables the low power acquisition mode, see idle_frame().
+ * Any thread, takes effect at the next frame. */
+void rx_set_low_power(int enable) {
+    g_low_power = enable;
+}
+
+/* How long to hold the demod's sync through a fade before starting
+ * acquisition again, 0 to start it straight away. Holds are cut short
+ * of the ACQ_HOLD frames after which the demod goes idle. Any thread,
+ * takes effect at the next frame. */
+void rx_set_fade_hold_ms(int ms) {
+    if (ms < 0)
+        return;
+    if (ms/FRAME_MS >= ACQ_HOLD)
+        g_fade_hold_frames = ACQ_HOLD - 1;
+    else
+        g_fade_hold_frames = ms/FRAME_MS;
+}
+
+/* Consistent copy of the latest demod telemetry. Never blocks the
+ * receive thread, call from any thread. */
+void rx_telemetry_snapshot(struct rx_telemetry *t) {
+    unsigned int s;
+
+    do {
+        s = seqlock_read_begin(&g_telemetry_seq);
+        *t = g_telemetry;
+    } while (seqlock_read_retry(&g_telemetry_seq, s));
+}
+
+/* Accepts any number of 48 kHz stereo samples. Every 8 kHz sample the
+ * resampler produces is kept for the demod, and one N8 block of
+ * speech is owed to jni_cb() for every N8 modem samples received, so
+ * the output keeps pace with the input whatever the block size. */
 int rx_decode_buffer(const short *buf_48k_stereo, int num_bytes_48k_stereo) {
 
     pthread_mutex_lock(&mutex);
-    int ret = 0, i;
+    rtmon_decode_begin();
+    int ret = 0, i, n, n8, space;
+    float lag;
 
     int num_shorts_48k_stereo = num_bytes_48k_stereo/2;
 
-    unsigned int num_shorts_48k_mono = num_shorts_48k_stereo/2;
-    short buf_8k_mono[N48*2];
-    short buf_48k_mono[1920];
+    int num_shorts_48k_mono = num_shorts_48k_stereo/2;
+    short buf_48k_mono[N48*2];
 
-    assert(num_shorts_48k_mono < sizeof(buf_48k_mono)/sizeof(short));
-
-    for(i = 0; i < num_shorts_48k_mono; i++, buf_48k_stereo += 2) {
-        buf_48k_mono[i] = *buf_48k_stereo;
-    }
-    resample_48k_to_8k(buf_8k_mono, buf_48k_mono, N48*2, i);
-    assert(shorts_in_8kbuf >= FDMDV_NOM_SAMPLES_PER_FRAME);
+    while (num_shorts_48k_mono > 0) {
+        n = num_shorts_48k_mono;
+        if (n > N48*2)
+            n = N48*2;
+        for(i = 0; i < n; i++, buf_48k_stereo += 2) {
+            buf_48k_mono[i] = *buf_48k_stereo;
+        }
+        num_shorts_48k_mono -= n;
 
-    /* Copy NOM_SAMPLES of shorts into &input_buf[n_input_buf] */
-    memcpy(&input_buf[n_input_buf], buf_8k_mono,
-            FDMDV_NOM_SAMPLES_PER_FRAME*sizeof(short));
-    n_input_buf += FDMDV_NOM_SAMPLES_PER_FRAME;
+        /* the demod leaves fewer than FDMDV_MAX_SAMPLES_PER_FRAME, so
+           there is always room for the n/FDMDV_OS we get back */
 
-    per_frame_rx_processing(output_buf, &n_output_buf,
-            codec_bits,
-            input_buf, &n_input_buf);
+        space = sample_ring_space(&g_in_ring);
+        n8 = resample_48k_to_8k(sample_ring_write_ptr(&g_in_ring), buf_48k_mono,
+                space < N48*2 ? space : N48*2, n);
+        sample_ring_commit(&g_in_ring, n8);
+        g_out_due += n8;
 
-    if (n_output_buf > N8) {
-        jni_cb((signed char *)output_buf, N8*sizeof(short));
+        per_frame_rx_processing(codec_bits, &g_in_ring);
 
-        n_output_buf -= N8;
-        assert(n_output_buf >= 0);
+        /* late speech is concealed, so there is always a block */
 
-        /* shift speech sample output buffer */
-        for(i=0; i<n_output_buf; i++)
-            output_buf[i] = output_buf[i+N8];
+        lag = sample_ring_avail(&g_in_ring) - stats.rx_timing;
+        while (g_out_due >= N8) {
+            g_out_due -= N8;
+            jni_cb((const signed char *)jbuf_get(N8, lag), N8*sizeof(short));
+            rtmon_delivered();
+        }
     }
 
+    rtmon_decode_end(jbuf_avail());
     pthread_mutex_unlock(&mutex);
     return ret;
 }
@@ -411,11 +561,22 @@ int freedv_create() {
 
     int src_error;
     insrc1 = src_new(SRC_SINC_FASTEST, 1, &src_error);
+    if (!jbuf_create())
+        return 0;
+    if (!waterfall_create(WATERFALL_DEFAULT_ROWS))
+        return 0;
 
     fdmdv = fdmdv_create();
     codec2 = codec2_create(CODEC2_MODE_1400);
-    output_buf =
-        (short*)malloc(2*sizeof(short)*codec2_samples_per_frame(codec2));
+    varicode_decode_init(&g_varicode_dec_states);
+    spsc_ring_init(&g_text_ring, g_text_buf, TEXT_RING_SIZE);
+    assert(codec2_samples_per_frame(codec2) <= 2*N8);
+    sample_ring_init(&g_in_ring, g_in_buf, IN_RING_SIZE);
+    g_out_due = 0;
+    acq_reset();
+    g_idle = 0;
+    g_unsync_frames = 0;
+    g_fade_hold_set = -1;
 
     return 1;
 }
@@ -425,8 +586,8 @@ void fdmdv_close() {
         fdmdv_destroy(fdmdv);
     if (codec2)
         codec2_destroy(codec2);
-    if (output_buf)
-        free(output_buf);
     if (insrc1)
-        free(insrc1);
+        src_delete(insrc1);
+    jbuf_destroy();
+    waterfall_destroy();
 }
@@ -1,8 +1,33 @@
 #ifndef FREEDV_RX_H
 #define FREEDV_RX_H
 
+#include <codec2_fdmdv.h>
+
+/* How long the demod holds its sync through a fade until
+   rx_set_fade_hold_ms() says otherwise. Longer holds are cut to just
+   under the ACQ_HOLD frames it takes to go idle. */
+#define RX_DEFAULT_FADE_HOLD_MS 1500
+
+/* Demod state for the UI, published once per frame. */
+struct rx_telemetry {
+    unsigned int frames;                  /* demod frames so far            */
+    int          sync;                    /* decoding speech                */
+    int          idle;                    /* demod off, waiting for a pilot */
+    float        pilot_db;                /* last pilot detector reading    */
+    float        snr_est;                 /* dB in 3 kHz                    */
+    float        foff;                    /* frequency offset, Hz           */
+    float        rx_timing;               /* timing offset, samples         */
+    float        clock_offset;            /* tx/rx sample clock offset, ppm */
+    COMP         rx_symbols[FDMDV_NSYM];  /* latest symbols, scatter plot   */
+    float        spectrum[FDMDV_NSPEC];   /* averaged rx spectrum, dB       */
+};
+
 int freedv_create(void);
 void fdmdv_close(void);
 int rx_decode_buffer(const short *buf_48k_stereo, int num_bytes_48k_stereo);
+int rx_get_text(char *text, int max);
+void rx_telemetry_snapshot(struct rx_telemetry *t);
+void rx_set_low_power(int enable);
+void rx_set_fade_hold_ms(int ms);
 
 #endif /* FREEDV_RX_H */
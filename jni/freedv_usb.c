@@ -19,6 +19,7 @@
 #include <libusb.h>
 
 #include "freedv_rx.h"
+#include "freedv_rtmon.h"
 
 /* TI PCM2900C Audio CODEC default VID/PID. */
 #define VID 0x08bb
@@ -50,6 +51,8 @@ static void transfer_cb(struct libusb_transfer *xfr) {
     int len = 0;
     unsigned int i;
 
+    rtmon_transfer_cb();
+
     /* All packets are 192 bytes. */
     uint8_t* recv = malloc(PACKET_SIZE * xfr->num_iso_packets);
     uint8_t* recv_next = recv;
@@ -0,0 +1,162 @@
+/*
+ * Waterfall display of the rx spectrum, rendered on the receive thread.
+ *
+ * Each frame's averaged spectrum is folded into a peak hold row, and
+ * at the configured row rate the row is mapped through a 256 colour
+ * LUT by the colour_map kernel (SIMD where the CPU has it) into a
+ * ring of RGBA rows. As in sample_ring.h every row is stored twice,
+ * rows apart, but in reverse: the newest row is written at the next
+ * lower index, so the latest rows always form one contiguous image
+ * with the newest at the top. A display layer just blits
+ * waterfall_image(), nothing is copied or converted on the UI side.
+ *
+ * The ring is published by bumping head after the row is written,
+ * readers only ever look at rows head covers.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "kernels.h"
+#include "freedv_waterfall.h"
+
+/* Colour stops of the LUT, quiet to loud. */
+static const unsigned char stops[][3] = {
+    {   0,   0,   0 },
+    {   0,   0, 200 },
+    {   0, 200, 200 },
+    { 240, 240,   0 },
+    { 255,   0,   0 },
+};
+#define NSTOPS (int)(sizeof(stops)/sizeof(stops[0]))
+
+static uint32_t *pixels;        /* 2*nrows rows of WATERFALL_WIDTH    */
+static int nrows;
+static uint32_t lut[256];
+static float peak[WATERFALL_WIDTH];
+static float elapsed;           /* seconds folded into peak[]         */
+static volatile unsigned int head;
+static volatile float rate = WATERFALL_DEFAULT_RATE;
+
+/* Pixel of 8 bit r, g, b as bytes R, G, B, A in memory (little endian). */
+static uint32_t rgba(int r, int g, int b) {
+    return 0xff000000 | (uint32_t)b << 16 | (uint32_t)g << 8 | (uint32_t)r;
+}
+
+static void make_lut(void) {
+    int i, s, c[3], k;
+    float t, f;
+
+    for (i = 0; i < 256; i++) {
+        t = (float)i/255*(NSTOPS - 1);
+        s = (int)t;
+        if (s >= NSTOPS - 1)
+            s = NSTOPS - 2;
+        f = t - s;
+        for (k = 0; k < 3; k++)
+            c[k] = stops[s][k] + f*(stops[s + 1][k] - stops[s][k]) + 0.5f;
+        lut[i] = rgba(c[0], c[1], c[2]);
+    }
+}
+
+static int row_index(unsigned int row) {
+    /* row r lands one below row r - 1, wrapping */
+    return nrows - 1 - (int)(row % nrows);
+}
+
+/*----------------------------------------------------------------*\
+
+  FUNCTION: waterfall_create()
+  DATE....: October 2026
+
+  Allocates a waterfall of rows rows, all at the quietest colour.
+  Returns 0 if rows is out of range or memory is short.
+
+\*----------------------------------------------------------------*/
+
+int waterfall_create(int rows) {
+    int i;
+
+    if (rows <= 0 || rows > WATERFALL_MAX_ROWS)
+        return 0;
+    kernels_init();
+    make_lut();
+    pixels = malloc(2*rows*WATERFALL_WIDTH*sizeof(uint32_t));
+    if (!pixels)
+        return 0;
+    nrows = rows;
+    for (i = 0; i < 2*rows*WATERFALL_WIDTH; i++)
+        pixels[i] = lut[0];
+    for (i = 0; i < WATERFALL_WIDTH; i++)
+        peak[i] = WATERFALL_MIN_DB;
+    elapsed = 0.0f;
+    head = 0;
+    return 1;
+}
+
+void waterfall_destroy(void) {
+    free(pixels);
+    pixels = NULL;
+    nrows = 0;
+}
+
+/*----------------------------------------------------------------*\
+
+  FUNCTION: waterfall_update()
+  DATE....: October 2026
+
+  Adds the spectrum of a frame covering secs seconds of signal.
+  Renders a row once 1/rate seconds have gone in, at most one row per
+  call, so rates above the frame rate give one row per frame.
+
+\*----------------------------------------------------------------*/
+
+void waterfall_update(const float spectrum_dB[], float secs) {
+    uint32_t *row;
+    int i;
+
+    if (!pixels)
+        return;
+    for (i = 0; i < WATERFALL_WIDTH; i++)
+        if (spectrum_dB[i] > peak[i])
+            peak[i] = spectrum_dB[i];
+    elapsed += secs;
+    if (elapsed*rate < 1.0f)
+        return;
+    elapsed = 0.0f;
+
+    row = &pixels[row_index(head)*WATERFALL_WIDTH];
+    kernels->colour_map(row, peak, WATERFALL_WIDTH, WATERFALL_MIN_DB,
+                        256.0f/(WATERFALL_MAX_DB - WATERFALL_MIN_DB), lut);
+    memcpy(row + nrows*WATERFALL_WIDTH, row, WATERFALL_WIDTH*sizeof(uint32_t));
+    for (i = 0; i < WATERFALL_WIDTH; i++)
+        peak[i] = WATERFALL_MIN_DB;
+
+    __sync_synchronize();
+    head++;
+}
+
+const uint32_t *waterfall_image(unsigned int *head_out) {
+    unsigned int h = head;
+
+    __sync_synchronize();
+    if (head_out)
+        *head_out = h;
+    if (!pixels)
+        return NULL;
+    /* newest row, the rows - 1 older ones follow it */
+    return &pixels[row_index(h - 1)*WATERFALL_WIDTH];
+}
+
+/* The whole ring, 2*rows rows, for mapping once; waterfall_image()
+ * always points inside it. */
+uint32_t *waterfall_pixels(int *rows) {
+    if (rows)
+        *rows = nrows;
+    return pixels;
+}
+
+void waterfall_set_rate(float rows_per_sec) {
+    if (rows_per_sec > 0.0f)
+        rate = rows_per_sec;
+}
@@ -0,0 +1,38 @@
+#ifndef FREEDV_WATERFALL_H
+#define FREEDV_WATERFALL_H
+
+#include <stdint.h>
+#include <codec2_fdmdv.h>
+
+/* One pixel per spectrum bin, 0 to 4 kHz left to right. */
+#define WATERFALL_WIDTH        FDMDV_NSPEC
+#define WATERFALL_DEFAULT_ROWS 256
+#define WATERFALL_MAX_ROWS     1024
+
+/* Rows added per second until waterfall_set_rate() says otherwise. */
+#define WATERFALL_DEFAULT_RATE 10.0f
+
+/* Levels mapped to the first and last colour. */
+#define WATERFALL_MIN_DB       -40.0f
+#define WATERFALL_MAX_DB         0.0f
+
+/* Called from the receive thread. */
+int waterfall_create(int rows);
+void waterfall_destroy(void);
+void waterfall_update(const float spectrum_dB[], float secs);
+
+/*
+ * Safe to call from any thread, never blocks the receive thread.
+ *
+ * waterfall_image() returns rows*WATERFALL_WIDTH RGBA pixels, newest row
+ * first, that can be blitted as they are: byte order R, G, B, A as
+ * Android's ARGB_8888 bitmaps and RGBA_8888 windows expect. *head is
+ * set to the number of rows rendered so far, so a display can skip
+ * redraws when it hasn't moved. Only the oldest row may be overwritten
+ * while it is being copied.
+ */
+const uint32_t *waterfall_image(unsigned int *head);
+uint32_t *waterfall_pixels(int *rows);
+void waterfall_set_rate(float rows_per_sec);
+
+#endif /* FREEDV_WATERFALL_H */
@@ -49,7 +49,9 @@ typedef float	coeff_t ;
 
 #include "fastest_coeffs.h"
 #include "mid_qual_coeffs.h"
+#ifndef SRC_NO_BEST_QUALITY
 #include "high_qual_coeffs.h"
+#endif
 
 typedef struct
 {	int		sinc_magic_marker ;
@@ -211,11 +213,13 @@ sinc_set_converter (SRC_PRIVATE *psrc, int src_enum)
 				temp_filter.index_inc = slow_mid_qual_coeffs.increment ;
 				break ;
 
+#ifndef SRC_NO_BEST_QUALITY
 		case SRC_SINC_BEST_QUALITY :
 				temp_filter.coeffs = slow_high_qual_coeffs.coeffs ;
 				temp_filter.coeff_half_len = ARRAY_LEN (slow_high_qual_coeffs.coeffs) - 1 ;
 				temp_filter.index_inc = slow_high_qual_coeffs.increment ;
 				break ;
+#endif
 
 		default :
 				return SRC_ERR_BAD_CONVERTER ;
@@ -0,0 +1,74 @@
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+/*
+ * Ring of 16 bit samples for the receive path. Every sample is stored
+ * twice, size samples apart, so the samples waiting to be read and
+ * the space waiting to be written are each one contiguous block. The
+ * demod and the audio sink read straight out of the ring, and the
+ * resampler and decoder write straight into it; nothing is shifted
+ * down after a read.
+ *
+ *   writer:                              reader:
+ *     x = sample_ring_write_ptr(&r);       x = sample_ring_read_ptr(&r);
+ *     ...write n <= space samples...       ...read n <= avail samples...
+ *     sample_ring_commit(&r, n);           sample_ring_consume(&r, n);
+ *
+ * Not thread safe, both sides run on the receive thread.
+ */
+
+#include <assert.h>
+#include <string.h>
+
+struct sample_ring {
+    short        *buf;    /* 2*size samples                         */
+    unsigned int  size;   /* power of two                           */
+    unsigned int  head;   /* samples ever written, wraps freely     */
+    unsigned int  tail;   /* samples ever read                      */
+};
+
+static inline void sample_ring_init(struct sample_ring *r, short *buf,
+                                    unsigned int size) {
+    assert(size && !(size & (size - 1)));
+    r->buf = buf;
+    r->size = size;
+    r->head = 0;
+    r->tail = 0;
+}
+
+static inline unsigned int sample_ring_avail(const struct sample_ring *r) {
+    return r->head - r->tail;
+}
+
+static inline unsigned int sample_ring_space(const struct sample_ring *r) {
+    return r->size - (r->head - r->tail);
+}
+
+/* sample_ring_avail() samples from here on are contiguous */
+static inline const short *sample_ring_read_ptr(const struct sample_ring *r) {
+    return &r->buf[r->tail & (r->size - 1)];
+}
+
+static inline void sample_ring_consume(struct sample_ring *r, unsigned int n) {
+    assert(n <= sample_ring_avail(r));
+    r->tail += n;
+}
+
+/* sample_ring_space() samples from here on are contiguous */
+static inline short *sample_ring_write_ptr(struct sample_ring *r) {
+    return &r->buf[r->head & (r->size - 1)];
+}
+
+/* Adds the n samples written at sample_ring_write_ptr(), copying them
+ * to their mirror in the other half of buf. */
+static inline void sample_ring_commit(struct sample_ring *r, unsigned int n) {
+    unsigned int h = r->head & (r->size - 1);
+    unsigned int first = r->size - h < n ? r->size - h : n;
+
+    assert(n <= sample_ring_space(r));
+    memcpy(&r->buf[h + r->size], &r->buf[h], first*sizeof(short));
+    memcpy(r->buf, &r->buf[r->size], (n - first)*sizeof(short));
+    r->head += n;
+}
+
+#endif /* SAMPLE_RING_H */
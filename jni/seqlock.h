@@ -0,0 +1,41 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+/*
+ * Single writer sequence lock. The writer never blocks; readers copy
+ * the protected data and retry if the writer was active meanwhile.
+ *
+ *   writer:                       reader:
+ *     seqlock_write_begin(&seq);    do {
+ *     ...update data...               s = seqlock_read_begin(&seq);
+ *     seqlock_write_end(&seq);        ...copy data...
+ *                                   } while (seqlock_read_retry(&seq, s));
+ */
+
+typedef volatile unsigned int seqlock_t;
+
+static inline void seqlock_write_begin(seqlock_t *seq) {
+    (*seq)++;
+    __sync_synchronize();
+}
+
+static inline void seqlock_write_end(seqlock_t *seq) {
+    __sync_synchronize();
+    (*seq)++;
+}
+
+static inline unsigned int seqlock_read_begin(seqlock_t *seq) {
+    unsigned int s;
+
+    while ((s = *seq) & 1)
+        ;
+    __sync_synchronize();
+    return s;
+}
+
+static inline int seqlock_read_retry(seqlock_t *seq, unsigned int s) {
+    __sync_synchronize();
+    return *seq != s;
+}
+
+#endif /* SEQLOCK_H */
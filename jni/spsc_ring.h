@@ -0,0 +1,84 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+/*
+ * Single producer, single consumer byte ring. Neither side blocks or
+ * takes a lock: only the producer writes head and only the consumer
+ * writes tail, each after a barrier that makes the bytes it wrote or
+ * read safe for the other side. The size must be a power of two, head
+ * and tail run freely and are masked on use.
+ *
+ *   producer:                          consumer:
+ *     spsc_ring_write(&r, data, n);      n = spsc_ring_read(&r, data, max);
+ */
+
+#include <assert.h>
+#include <string.h>
+
+struct spsc_ring {
+    unsigned char         *buf;
+    unsigned int           size;
+    volatile unsigned int  head;    /* written by the producer only */
+    volatile unsigned int  tail;    /* written by the consumer only */
+};
+
+static inline void spsc_ring_init(struct spsc_ring *r, unsigned char *buf,
+                                  unsigned int size) {
+    assert(size && !(size & (size - 1)));
+    r->buf = buf;
+    r->size = size;
+    r->head = 0;
+    r->tail = 0;
+}
+
+/* Copies n bytes at index pos of the ring in up to two pieces. */
+static inline void spsc_ring_copy_out(const struct spsc_ring *r, unsigned int pos,
+                                      unsigned char *data, unsigned int n) {
+    unsigned int i = pos & (r->size - 1);
+    unsigned int first = r->size - i < n ? r->size - i : n;
+
+    memcpy(data, &r->buf[i], first);
+    memcpy(data + first, r->buf, n - first);
+}
+
+static inline void spsc_ring_copy_in(struct spsc_ring *r, unsigned int pos,
+                                     const unsigned char *data, unsigned int n) {
+    unsigned int i = pos & (r->size - 1);
+    unsigned int first = r->size - i < n ? r->size - i : n;
+
+    memcpy(&r->buf[i], data, first);
+    memcpy(r->buf, data + first, n - first);
+}
+
+/* Producer side. Returns the number of bytes written, fewer than n if
+ * the ring is full. */
+static inline unsigned int spsc_ring_write(struct spsc_ring *r, const void *data,
+                                           unsigned int n) {
+    unsigned int head = r->head;
+    unsigned int space = r->size - (head - r->tail);
+
+    if (n > space)
+        n = space;
+    __sync_synchronize();
+    spsc_ring_copy_in(r, head, data, n);
+    __sync_synchronize();
+    r->head = head + n;
+    return n;
+}
+
+/* Consumer side. Returns the number of bytes read, at most max. */
+static inline unsigned int spsc_ring_read(struct spsc_ring *r, void *data,
+                                          unsigned int max) {
+    unsigned int tail = r->tail;
+    unsigned int n = r->head - tail;
+
+    if (n > max)
+        n = max;
+    __sync_synchronize();
+    spsc_ring_copy_out(r, tail, data, n);
+    __sync_synchronize();
+    r->tail = tail + n;
+    return n;
+}
+
+#endif /* SPSC_RING_H */
@@ -4,20 +4,26 @@ import android.media.AudioFormat;
 import android.media.AudioManager;
 import android.media.AudioTrack;
 import android.os.Handler;
+import java.nio.ByteBuffer;
 import android.util.Log;
 
 public class AudioPlayback {
 	private static final String TAG = "AudioPlayback";
 	
 	private static final int SAMPLE_RATE_HZ = 8000;
+	private static final int AUDIO_BUF_BYTES = 4096;
 
 	private AudioTrack track;
-	private Handler mStatsHandler;
 	private Handler mSyncHandler;
+
+	// Filled by the native code before each write() upcall, so nothing
+	// is allocated per frame. Looked up by name from freedv_jni.c, keep
+	// the name in step.
+	private final ByteBuffer mAudioBuf = ByteBuffer.allocateDirect(AUDIO_BUF_BYTES);
+	private final byte[] mAudioBytes = new byte[AUDIO_BUF_BYTES];
 	
-	AudioPlayback(Handler syncHandler, Handler statsHandler) {
+	AudioPlayback(Handler syncHandler) {
 		mSyncHandler = syncHandler;
-		mStatsHandler = statsHandler;
 		int bufSize = AudioTrack.getMinBufferSize(SAMPLE_RATE_HZ, 
 				AudioFormat.CHANNEL_OUT_MONO, AudioFormat.ENCODING_PCM_16BIT);
 		Log.d(TAG, "Buf size: " + bufSize);
@@ -35,8 +41,10 @@ public class AudioPlayback {
 		track.play();
 	}
 	
-	public void write(byte[] decodedAudio) {
-		track.write(decodedAudio, 0, decodedAudio.length);
+	public void write(int len) {
+		mAudioBuf.position(0);
+		mAudioBuf.get(mAudioBytes, 0, len);
+		track.write(mAudioBytes, 0, len);
 	}
 	
 	public void stop() {
@@ -52,9 +60,4 @@ public class AudioPlayback {
 //		Log.d(TAG, "Sync is now " + sync);
         mSyncHandler.obtainMessage(1, sync).sendToTarget();
 	}
-	
-	public void stats(float foff, float rxTiming,  float[] symbols, float[] spectrum) {
-		FdmdvStats s = new FdmdvStats(foff, rxTiming, symbols, spectrum);
-        mStatsHandler.obtainMessage(1, s).sendToTarget();
-	}
 }
@@ -1,16 +1,17 @@
 package au.id.jms.freedvdroid;
 
 public class FdmdvStats {
+	// Must match FDMDV_NSYM and FDMDV_NSPEC in codec2_fdmdv.h
+	public static final int NSYM = 15;
+	public static final int NSPEC = 512;
 	
+	// Filled in by Freedv.getStats(), by field name
+	public int frames;
+	public boolean sync;
+	public float snrEstDb;
 	public float freqOffEstHz;
 	public float rxTimingEstSamples;
-	public float[] rxSymbols;
-	public float[] avgSpectrum;
-
-	FdmdvStats(float foff, float rx_timing, float[] symbols, float[] spectrum) {
-		freqOffEstHz = foff;
-		rxTimingEstSamples = rx_timing;
-		rxSymbols = symbols;
-		avgSpectrum = spectrum;
-	}
+	public float clockOffsetPpm;
+	public final float[] rxSymbols = new float[2*NSYM];
+	public final float[] avgSpectrum = new float[NSPEC];
 }
@@ -1,5 +1,7 @@
 package au.id.jms.freedvdroid;
 
+import java.nio.ByteBuffer;
+
 public class Freedv {
     static {
         System.loadLibrary("freedv");
@@ -10,4 +12,26 @@ public class Freedv {
 
     public native boolean setup(AudioPlayback c);
     public native boolean close();
+
+    /* Text received in the data channel since the last call. */
+    public native String getText();
+
+    /* Latest demod stats, copied into the arrays already in stats. */
+    public native void getStats(FdmdvStats stats);
+
+    /* The waterfall's RGBA ring, valid from setup() until close().
+     * waterfallOffset() is where the current image starts in it. */
+    public native ByteBuffer getWaterfall();
+    public native int waterfallRows();
+    public native int waterfallOffset();
+    public native void setWaterfallRate(float rowsPerSec);
+
+    /* Speech output latency to aim for, in milliseconds. */
+    public native void setLatency(int ms);
+
+    /* Sleep the demod on an empty channel until a pilot shows up. */
+    public native void setLowPower(boolean enable);
+
+    /* Longest fade, in milliseconds, to ride out before acquiring again. */
+    public native void setFadeHold(int ms);
 }
\ No newline at end of file
@@ -26,6 +26,7 @@ import android.view.View;
 import android.widget.Button;
 import android.widget.LinearLayout;
 import android.widget.RadioButton;
+import android.widget.TextView;
 import au.id.jms.graphview.GraphView;
 import au.id.jms.graphview.GraphView.GraphViewData;
 import au.id.jms.graphview.GraphView.GraphViewSeries;
@@ -39,6 +40,8 @@ public class MainActivity extends Activity {
     private static final String ACTION_USB_PERMISSION = "au.id.jms.freedvdroid.USB_PERMISSION";
 
 	private static final int HISTORY_SIZE = 60;
+	private static final int STATS_POLL_MS = 100;
+	private static final int RX_TEXT_MAX = 256;
     PendingIntent mPermissionIntent = null;
     UsbManager mUsbManager = null;
     UsbDevice mAudioDevice = null;
@@ -53,6 +56,8 @@ public class MainActivity extends Activity {
 
 	private static Handler mSyncHandler;
 	private static Handler mStatsHandler;
+	private final FdmdvStats mStats = new FdmdvStats();
+	private int mStatsFrames;
 	
 	private int graphOffsetX;
 	private GraphView freqOffsetGraphView;
@@ -63,6 +68,9 @@ public class MainActivity extends Activity {
 	private GraphViewSeries timingEstSeries;
 	
 	private ScatterGraphView mScatter;
+	private WaterfallView mWaterfall;
+	private TextView mRxText;
+	private final StringBuilder mRxTextBuf = new StringBuilder();
 	
     @Override
     protected void onCreate(Bundle savedInstanceState) {
@@ -94,13 +102,7 @@ public class MainActivity extends Activity {
 				updateSyncState((Boolean) msg.obj);
 			}
 		};
-		mStatsHandler = new Handler() {
-			@Override
-			public void handleMessage(Message msg) {
-				FdmdvStats stats = (FdmdvStats) msg.obj;
-				updateStatsGraph(stats);
-			}
-		};
+		mStatsHandler = new Handler();
 		
 		freqOffsetGraphView = new LineGraphView(this, "Frequency Estimation");
 		((LinearLayout) findViewById(R.id.graph1)).addView(freqOffsetGraphView);
@@ -109,9 +111,11 @@ public class MainActivity extends Activity {
 		((LinearLayout) findViewById(R.id.graph2)).addView(timingEstGraphView);
         
     	mUsbAudio = new Freedv();
-    	mAudioPlayback = new AudioPlayback(mSyncHandler, mStatsHandler);
+    	mAudioPlayback = new AudioPlayback(mSyncHandler);
     	
     	mScatter = (ScatterGraphView) findViewById(R.id.scattergraph);
+    	mWaterfall = (WaterfallView) findViewById(R.id.waterfall);
+    	mRxText = (TextView) findViewById(R.id.rxText);
     	
     	// Buttons
 		final Button startButton = (Button) findViewById(R.id.button1);
@@ -130,6 +134,8 @@ public class MainActivity extends Activity {
 		    		stopButton.setEnabled(true);
 		    		
 					graphOffsetX = 0;
+					mRxTextBuf.setLength(0);
+					mRxText.setText(mRxTextBuf);
 					
 					Log.d(TAG, "Graph setup");
 					freqOffsetData = new ArrayList<GraphViewData>(HISTORY_SIZE); 
@@ -141,6 +147,9 @@ public class MainActivity extends Activity {
 			        		new GraphViewStyle(Color.rgb(50, 200, 00), 3), timingEstData);
 					timingEstGraphView.addSeries(timingEstSeries);
 
+					mWaterfall.attach(mUsbAudio.getWaterfall(), mUsbAudio.waterfallRows());
+					mStatsFrames = 0;
+					mStatsHandler.postDelayed(mStatsPoll, STATS_POLL_MS);
 		    	}
 			}
 		});
@@ -148,6 +157,8 @@ public class MainActivity extends Activity {
 		stopButton.setOnClickListener(new View.OnClickListener() {
 			public void onClick(View v) {
 				Log.d(TAG, "Stop pressed");
+				mStatsHandler.removeCallbacks(mStatsPoll);
+				mWaterfall.detach();
 		    	mUsbAudio.close();
 		    	mAudioPlayback.pause();
 		    	
@@ -183,6 +194,33 @@ public class MainActivity extends Activity {
     	r.setChecked(state);
     }
     
+    // The demod publishes its stats every frame, we only look at the
+    // latest ones each time the graphs are redrawn.
+    private final Runnable mStatsPoll = new Runnable() {
+    	public void run() {
+    		mUsbAudio.getStats(mStats);
+    		mWaterfall.update(mUsbAudio.waterfallOffset());
+    		updateRxText(mUsbAudio.getText());
+    		if (mStats.frames != mStatsFrames) {
+    			mStatsFrames = mStats.frames;
+    			updateStatsGraph(mStats);
+    		}
+    		mStatsHandler.postDelayed(this, STATS_POLL_MS);
+    	}
+    };
+    
+    // Text from the data channel, the latest RX_TEXT_MAX characters.
+    private void updateRxText(String text) {
+    	if (text.length() == 0) {
+    		return;
+    	}
+    	mRxTextBuf.append(text.replace('\n', ' ').replace('\r', ' '));
+    	if (mRxTextBuf.length() > RX_TEXT_MAX) {
+    		mRxTextBuf.delete(0, mRxTextBuf.length() - RX_TEXT_MAX);
+    	}
+    	mRxText.setText(mRxTextBuf);
+    }
+
     public void updateStatsGraph(FdmdvStats stats) {
     	
     	mScatter.addPoint(stats.rxSymbols);
@@ -220,6 +258,7 @@ public class MainActivity extends Activity {
     @Override
     protected void onPause() {
     	super.onPause();
+    	mStatsHandler.removeCallbacks(mStatsPoll);
     	if (mAudioPlayback != null) {
     		mAudioPlayback.pause();
     	}
@@ -229,6 +268,8 @@ public class MainActivity extends Activity {
     protected void onDestroy() {
     	super.onDestroy();
     	unregisterReceiver(mUsbPermissionReciever);
+    	mStatsHandler.removeCallbacks(mStatsPoll);
+    	mWaterfall.detach();
     	if (mAudioPlayback != null) {
     		mAudioPlayback.stop();
     		mAudioPlayback = null;
@@ -0,0 +1,65 @@
+package au.id.jms.freedvdroid;
+
+import java.nio.ByteBuffer;
+
+import android.content.Context;
+import android.graphics.Bitmap;
+import android.graphics.Canvas;
+import android.graphics.Paint;
+import android.graphics.Rect;
+import android.util.AttributeSet;
+import android.view.View;
+
+// Shows the waterfall rendered by the native code. The pixels are
+// already RGBA, each update is a single copy into the bitmap.
+public class WaterfallView extends View {
+
+	// Must match WATERFALL_WIDTH in freedv_waterfall.h
+	private static final int WIDTH = 512;
+
+	private ByteBuffer mRing;
+	private Bitmap mBitmap;
+	private int mOffset = -1;
+	private final Paint mPaint = new Paint(Paint.FILTER_BITMAP_FLAG);
+	private final Rect mDst = new Rect();
+
+	public WaterfallView(Context context) {
+		super(context);
+	}
+
+	public WaterfallView(Context context, AttributeSet attrs) {
+		super(context, attrs);
+	}
+
+	public void attach(ByteBuffer ring, int rows) {
+		mRing = ring;
+		mOffset = -1;
+		if (mBitmap == null || mBitmap.getHeight() != rows) {
+			mBitmap = Bitmap.createBitmap(WIDTH, rows, Bitmap.Config.ARGB_8888);
+		}
+	}
+
+	// The ring is freed by Freedv.close(), let go of it first.
+	public void detach() {
+		mRing = null;
+	}
+
+	public void update(int offset) {
+		if (mRing == null || offset == mOffset) {
+			return;
+		}
+		mOffset = offset;
+		mRing.position(offset);
+		mBitmap.copyPixelsFromBuffer(mRing);
+		invalidate();
+	}
+
+	@Override
+	protected void onDraw(Canvas canvas) {
+		super.onDraw(canvas);
+		if (mBitmap != null) {
+			mDst.set(0, 0, getWidth(), getHeight());
+			canvas.drawBitmap(mBitmap, null, mDst, mPaint);
+		}
+	}
+}